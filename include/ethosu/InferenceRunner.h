@@ -3,6 +3,400 @@
 
 #include <zephyr/kernel.h>
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief How InferenceRunner handles input arriving faster than it can be inferred.
+ */
+enum class InferenceInputPolicy {
+	/** Input is read in the inference thread; the source blocks or buffers on its own. */
+	Block,
+	/** Input is captured in its own thread; only the newest frame is kept, older are dropped. */
+	LatestFrameWins,
+	/** Input is captured in its own thread into a FIFO of QueueDepth frames, oldest dropped. */
+	QueueN,
+};
+
+/**
+ * @brief Why the inference loop last stopped, see InferenceRunner::GetStatus().
+ */
+enum class InferenceRunnerStatus {
+	Ok,                /* Running, or stopped through Stop() */
+	ModelInitFailed,   /* Model::Init() failed, the loop never runs */
+	InputStartFailed,  /* Input::Start() failed */
+	InputPumpFailed,   /* The input capture thread could not be started */
+	InputEnded,        /* Input::GetInputData() failed without a Stop() */
+	PreProcessFailed,
+	InferenceFailed,
+	PostProcessFailed,
+};
+
+/**
+ * @brief Per-result metadata passed to OutputHandlers that accept it.
+ */
+struct InferenceFrameInfo {
+	uint32_t sequence;  /* Capture sequence number, gaps indicate dropped frames */
+	uint32_t latencyUs; /* Time from input capture complete to result ready */
+};
+
+/**
+ * @brief Stages of one InferenceRunner iteration, used to index InferenceStats::stages.
+ */
+enum class InferenceStage {
+	Input,       /* Waiting for and copying input data */
+	PreProcess,
+	Inference,
+	PostProcess,
+	Output,      /* OutputHandler::ProcessOutput() */
+	Count,
+};
+
+/**
+ * @brief Wall-clock and thread CPU time of one stage, in microseconds.
+ *
+ * CPU time requires CONFIG_SCHED_THREAD_USAGE and reads zero otherwise. The difference between
+ * the two is time the inference thread spent blocked, e.g. waiting for the NPU or input.
+ */
+struct InferenceStageStats {
+	uint32_t minUs;
+	uint32_t avgUs;
+	uint32_t maxUs;
+	uint32_t cpuMinUs;
+	uint32_t cpuAvgUs;
+	uint32_t cpuMaxUs;
+};
+
+/**
+ * @brief Input freshness counters, see InferenceRunner::GetFrameStats().
+ */
+struct InferenceFrameStats {
+	uint32_t captured;      /* Frames delivered by Input::GetInputData() */
+	uint32_t dropped;       /* Frames discarded before reaching the model */
+	uint32_t results;       /* Results passed to the OutputHandler */
+	uint32_t lastLatencyUs; /* End-to-end latency of the most recent result */
+	uint32_t minLatencyUs;
+	uint32_t maxLatencyUs;
+	uint64_t sumLatencyUs; /* Divide by results for the average */
+};
+
+namespace inference_runner_detail
+{
+
+/* Input is read synchronously into the model input buffer, no extra copy or thread. */
+template <typename Input> class BlockingInputPump
+{
+public:
+	bool Start(Input *input)
+	{
+		m_input = input;
+		return true;
+	}
+
+	void Stop(void)
+	{
+	}
+
+	bool Acquire(void *buffer, uint32_t &timestamp, uint32_t &sequence)
+	{
+		if (!m_input->GetInputData(buffer)) {
+			return false;
+		}
+
+		timestamp = k_cycle_get_32();
+		sequence = m_sequence++;
+
+		return true;
+	}
+
+	void GetCounts(uint32_t &captured, uint32_t &dropped) const
+	{
+		captured = m_sequence;
+		dropped = 0;
+	}
+
+private:
+	Input *m_input = nullptr;
+	uint32_t m_sequence = 0;
+};
+
+/*
+ * Input is captured in a dedicated thread into a pool of Depth + 2 slots: one being written,
+ * one being consumed and up to Depth ready frames. When the ready queue is full the oldest frame
+ * is dropped, so the producer never blocks on the inference thread.
+ */
+template <typename Input, size_t Depth, size_t StackSize, int ThreadPriority>
+class ThreadedInputPump
+{
+public:
+	static_assert(Depth > 0, "Input queue depth must be at least one frame");
+	static_assert(Depth + 2 <= UINT8_MAX, "Input queue depth too large");
+
+	ThreadedInputPump()
+	{
+		k_sem_init(&m_readySem, 0, 1);
+	}
+
+	bool Start(Input *input)
+	{
+		if (m_threadStarted) {
+			return false;
+		}
+
+		m_input = input;
+		m_producerDone = false;
+		m_readyHead = 0;
+		m_readyCount = 0;
+		m_freeCount = 0;
+
+		for (size_t i = 1; i < NumSlots; i++) {
+			m_free[m_freeCount++] = i;
+		}
+		m_writeSlot = 0;
+
+		k_sem_reset(&m_readySem);
+		k_thread_create(&m_thread, m_stack, K_THREAD_STACK_SIZEOF(m_stack), ThreadEntry,
+				this, NULL, NULL, ThreadPriority, 0, K_NO_WAIT);
+		m_threadStarted = true;
+
+		return true;
+	}
+
+	/* Input::Stop() must have been called first to unblock a pending GetInputData() */
+	void Stop(void)
+	{
+		if (!m_threadStarted) {
+			return;
+		}
+
+		k_thread_join(&m_thread, K_FOREVER);
+		m_threadStarted = false;
+
+		/* Frames still queued are stale by the time the runner is restarted */
+		k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+		m_dropped += m_readyCount;
+		m_readyCount = 0;
+		k_spin_unlock(&m_lock, key);
+	}
+
+	bool Acquire(void *buffer, uint32_t &timestamp, uint32_t &sequence)
+	{
+		uint8_t slot;
+
+		while (true) {
+			k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+			if (m_readyCount > 0) {
+				slot = m_ready[m_readyHead];
+				m_readyHead = (m_readyHead + 1) % Depth;
+				m_readyCount--;
+				k_spin_unlock(&m_lock, key);
+				break;
+			}
+
+			const bool done = m_producerDone;
+
+			k_spin_unlock(&m_lock, key);
+
+			if (done) {
+				return false;
+			}
+
+			k_sem_take(&m_readySem, K_FOREVER);
+		}
+
+		memcpy(buffer, m_slots[slot], Input::OutputSize);
+		timestamp = m_timestamp[slot];
+		sequence = m_sequence[slot];
+
+		k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+		m_free[m_freeCount++] = slot;
+		k_spin_unlock(&m_lock, key);
+
+		return true;
+	}
+
+	void GetCounts(uint32_t &captured, uint32_t &dropped)
+	{
+		k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+		captured = m_captured;
+		dropped = m_dropped;
+		k_spin_unlock(&m_lock, key);
+	}
+
+private:
+	static constexpr size_t NumSlots = Depth + 2;
+
+	static void ThreadEntry(void *ctx, void *, void *)
+	{
+		static_cast<ThreadedInputPump *>(ctx)->Run();
+	}
+
+	void Run(void)
+	{
+		while (m_input->GetInputData(m_slots[m_writeSlot])) {
+			const uint32_t timestamp = k_cycle_get_32();
+			k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+			m_timestamp[m_writeSlot] = timestamp;
+			m_sequence[m_writeSlot] = m_captured++;
+
+			if (m_readyCount == Depth) {
+				m_free[m_freeCount++] = m_ready[m_readyHead];
+				m_readyHead = (m_readyHead + 1) % Depth;
+				m_readyCount--;
+				m_dropped++;
+			}
+
+			m_ready[(m_readyHead + m_readyCount) % Depth] = m_writeSlot;
+			m_readyCount++;
+			m_writeSlot = m_free[--m_freeCount];
+			k_spin_unlock(&m_lock, key);
+
+			k_sem_give(&m_readySem);
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&m_lock);
+
+		m_producerDone = true;
+		k_spin_unlock(&m_lock, key);
+
+		k_sem_give(&m_readySem);
+	}
+
+	Input *m_input = nullptr;
+	uint8_t m_slots[NumSlots][Input::OutputSize] __aligned(4);
+	uint32_t m_timestamp[NumSlots];
+	uint32_t m_sequence[NumSlots];
+	uint8_t m_ready[Depth];
+	uint8_t m_free[NumSlots];
+	size_t m_readyHead = 0;
+	size_t m_readyCount = 0;
+	size_t m_freeCount = 0;
+	uint8_t m_writeSlot = 0;
+	bool m_producerDone = false;
+	bool m_threadStarted = false;
+	uint32_t m_captured = 0;
+	uint32_t m_dropped = 0;
+	struct k_spinlock m_lock;
+	struct k_sem m_readySem;
+	K_KERNEL_STACK_MEMBER(m_stack, StackSize);
+	struct k_thread m_thread;
+};
+
+/*
+ * Priority of the capture thread: one level above the inference thread, but never leaving its
+ * class, so a preemptive runner does not get a cooperative capture thread and vice versa.
+ */
+constexpr int CapturePriority(int priority)
+{
+	return (priority == 0 || priority == K_HIGHEST_APPLICATION_THREAD_PRIO) ? priority
+										 : priority - 1;
+}
+
+template <typename Input, InferenceInputPolicy Policy, size_t QueueDepth, size_t StackSize,
+	  int ThreadPriority>
+using InputPump = std::conditional_t<
+	Policy == InferenceInputPolicy::Block, BlockingInputPump<Input>,
+	ThreadedInputPump<Input, Policy == InferenceInputPolicy::LatestFrameWins ? 1 : QueueDepth,
+			  StackSize, ThreadPriority>>;
+
+/* Detects OutputHandler::ProcessOutput(const T &, const InferenceFrameInfo &) */
+template <typename Handler, typename Result, typename = void>
+struct AcceptsFrameInfo : std::false_type {
+};
+
+template <typename Handler, typename Result>
+struct AcceptsFrameInfo<Handler, Result,
+			std::void_t<decltype(std::declval<Handler &>().ProcessOutput(
+				std::declval<const Result &>(),
+				std::declval<const InferenceFrameInfo &>()))>> : std::true_type {
+};
+
+struct StageAccumulator {
+	uint32_t minUs;
+	uint32_t maxUs;
+	uint64_t sumUs;
+	uint32_t cpuMinUs;
+	uint32_t cpuMaxUs;
+	uint64_t cpuSumUs;
+
+	void Add(uint32_t us, uint32_t cpuUs, bool first)
+	{
+		if (first || us < minUs) {
+			minUs = us;
+		}
+		if (first || cpuUs < cpuMinUs) {
+			cpuMinUs = cpuUs;
+		}
+		if (us > maxUs) {
+			maxUs = us;
+		}
+		if (cpuUs > cpuMaxUs) {
+			cpuMaxUs = cpuUs;
+		}
+		sumUs += us;
+		cpuSumUs += cpuUs;
+	}
+
+	InferenceStageStats Get(uint32_t count) const
+	{
+		InferenceStageStats stats = {};
+
+		if (count == 0) {
+			return stats;
+		}
+
+		stats.minUs = minUs;
+		stats.avgUs = static_cast<uint32_t>(sumUs / count);
+		stats.maxUs = maxUs;
+		stats.cpuMinUs = cpuMinUs;
+		stats.cpuAvgUs = static_cast<uint32_t>(cpuSumUs / count);
+		stats.cpuMaxUs = cpuMaxUs;
+
+		return stats;
+	}
+};
+
+/* Wall-clock cycle counter paired with the calling thread's accumulated execution cycles */
+struct StageClock {
+	uint32_t cycles;
+	uint64_t cpuCycles;
+
+	static StageClock Now(void)
+	{
+		StageClock now;
+
+		now.cycles = k_cycle_get_32();
+#ifdef CONFIG_SCHED_THREAD_USAGE
+		k_thread_runtime_stats_t rt;
+
+		k_thread_runtime_stats_get(k_current_get(), &rt);
+		now.cpuCycles = rt.execution_cycles;
+#else
+		now.cpuCycles = 0;
+#endif
+		return now;
+	}
+};
+
+} // namespace inference_runner_detail
+
+/**
+ * @brief Aggregate runtime statistics, see InferenceRunner::GetStats().
+ */
+struct InferenceStats {
+	uint32_t inferences; /* Completed iterations since the last ResetStats() */
+	uint32_t failures;   /* Iterations aborted by a failing stage */
+	InferenceStageStats stages[static_cast<size_t>(InferenceStage::Count)];
+	InferenceFrameStats frames;
+};
+
 /**
  * @brief InferenceRunner: A reusable threaded inference loop for embedded ML using Zephyr RTOS.
  *
@@ -41,6 +435,10 @@
  *                        class OutputHandler {
  *                            void ProcessOutput(const T& result);
  *                        };
+ *                        Optionally:
+ *                            void ProcessOutput(const T& result,
+ *                                               const InferenceFrameInfo& info);
+ *                        is preferred when present to receive per-result latency.
  *                        ----------------------------------------
  *                        Notes:
  *                        - Called in the inference thread context.
@@ -49,27 +447,48 @@
  *
  * @tparam StackSize      Size of the Zephyr thread's stack (default: 2024 bytes).
  * @tparam ThreadPriority Zephyr thread priority (default: 10).
+ * @tparam InputPolicy    Back-pressure policy when input outpaces inference (default: Block).
+ *                        LatestFrameWins and QueueN capture input in a separate thread running
+ *                        one priority level above the inference thread (the same level when
+ *                        ThreadPriority is 0 or the highest cooperative priority), at the cost of
+ *                        (depth + 2) * Input::OutputSize bytes of frame buffers and one copy per
+ *                        frame into the model input buffer.
+ * @tparam InputQueueDepth Number of frames kept for QueueN (default: 2).
+ * @tparam InputStackSize Stack size of the input capture thread (default: 1024 bytes).
  *
  * @note Copy/move constructors and assignment operators are disabled due to internal thread/stack
  * ownership.
- * @note The thread starts once via `Start()` and terminates cleanly in the destructor.
+ * @note The thread is created by the first `Start()`, which also runs `Model::Init()`. `Stop()`
+ * lets the in-flight iteration finish, stops the input and parks the thread; a later `Start()`
+ * resumes without re-initializing the model. The thread terminates in the destructor.
+ * @note When the loop stops on its own because a stage failed, IsRunning() turns false and
+ * GetStatus() tells why; Start() can then be called again.
  *
  * @example
  *   using MyRunner = InferenceRunner<MyModel, MyInput, MyOutputHandler<MyModel::Result>>;
  *   MyRunner runner;
  *   runner.Start();
+ *   ...
+ *   runner.Stop(K_FOREVER);
  */
 
 template <typename Model, typename Input, typename OutputHandler, size_t StackSize = 2024,
-	int ThreadPriority = 10>
+	  int ThreadPriority = 10, InferenceInputPolicy InputPolicy = InferenceInputPolicy::Block,
+	  size_t InputQueueDepth = 2, size_t InputStackSize = 1024>
 class InferenceRunner
 {
 public:
 	static_assert(Model::InputSize == Input::OutputSize);
+	static_assert(ThreadPriority >= K_HIGHEST_APPLICATION_THREAD_PRIO &&
+			      ThreadPriority <= K_LOWEST_APPLICATION_THREAD_PRIO,
+		      "ThreadPriority is not a valid application thread priority");
 
 	InferenceRunner()
 	{
-		k_sem_init(&m_inferenceSem, 0, 1);
+		k_sem_init(&m_startSem, 0, 1);
+		k_sem_init(&m_stopSem, 0, 1);
+		k_mutex_init(&m_ctlLock);
+		k_condvar_init(&m_idleCond);
 	}
 
 	InferenceRunner(const InferenceRunner &) = delete;
@@ -79,24 +498,180 @@ public:
 
 	~InferenceRunner()
 	{
-		m_input.Stop();
-		k_sem_give(&m_inferenceSem);
+		if (!m_threadCreated) {
+			return;
+		}
+
+		Stop(K_FOREVER);
+		m_exit = true;
+		k_sem_give(&m_startSem);
 		k_thread_join(&m_inferenceThread, K_FOREVER);
 	}
 
+	/**
+	 * @brief Start or resume the inference loop.
+	 *
+	 * The first call creates the inference thread and initializes the model. Calling it while
+	 * already running has no effect. After a Stop() that timed out, it waits for the loop to
+	 * park before starting it again.
+	 */
 	void Start(void)
 	{
-		if (m_started) {
+		k_mutex_lock(&m_ctlLock, K_FOREVER);
+
+		while (m_stopping) {
+			k_condvar_wait(&m_idleCond, &m_ctlLock, K_FOREVER);
+		}
+
+		if (m_active) {
+			k_mutex_unlock(&m_ctlLock);
 			return;
 		}
 
-		m_started = true;
+		m_active = true;
+		atomic_set(&m_running, 1);
+		atomic_set(&m_status, static_cast<atomic_val_t>(InferenceRunnerStatus::Ok));
+		k_sem_reset(&m_stopSem);
+
+		if (!m_threadCreated) {
+			m_threadCreated = true;
+			k_thread_create(&m_inferenceThread, m_stack, K_THREAD_STACK_SIZEOF(m_stack),
+					ThreadEntry, this, NULL, NULL, ThreadPriority, 0,
+					K_NO_WAIT);
+		}
+
+		k_sem_give(&m_startSem);
+		k_mutex_unlock(&m_ctlLock);
+	}
+
+	/**
+	 * @brief Stop the inference loop, keeping the model initialized.
+	 *
+	 * The iteration in progress completes and its result is delivered. A pending input read
+	 * is aborted through Input::Stop().
+	 *
+	 * @param timeout How long to wait for the loop to drain.
+	 * @return true when the loop is stopped, false on timeout (the stop is still pending).
+	 */
+	bool Stop(k_timeout_t timeout)
+	{
+		const k_timepoint_t end = sys_timepoint_calc(timeout);
+		bool stopped;
+
+		k_mutex_lock(&m_ctlLock, K_FOREVER);
+		if (!m_active) {
+			k_mutex_unlock(&m_ctlLock);
+			return true;
+		}
+		if (!m_stopping) {
+			m_stopping = true;
+			k_sem_give(&m_stopSem);
+		}
+		k_mutex_unlock(&m_ctlLock);
+
+		StopInput();
+
+		/* The loop clears m_active itself once it is parked */
+		k_mutex_lock(&m_ctlLock, K_FOREVER);
+		while (m_active) {
+			if (k_condvar_wait(&m_idleCond, &m_ctlLock, sys_timepoint_timeout(end)) != 0) {
+				break;
+			}
+		}
+		stopped = !m_active;
+		k_mutex_unlock(&m_ctlLock);
+
+		return stopped;
+	}
+
+	/**
+	 * @brief Stop and start again, e.g. to flush stale input after a pause.
+	 */
+	bool Restart(k_timeout_t timeout)
+	{
+		if (!Stop(timeout)) {
+			return false;
+		}
+
+		Start();
+
+		return true;
+	}
+
+	/**
+	 * @brief Whether the loop is running; false once it stopped on its own after a failure.
+	 */
+	bool IsRunning(void)
+	{
+		return atomic_get(&m_running) != 0;
+	}
+
+	/**
+	 * @brief Reason the loop last stopped, Ok while running or after Stop().
+	 */
+	InferenceRunnerStatus GetStatus(void)
+	{
+		return static_cast<InferenceRunnerStatus>(atomic_get(&m_status));
+	}
+
+	/**
+	 * @brief Snapshot of input freshness counters, safe to call from any thread.
+	 */
+	InferenceFrameStats GetFrameStats(void)
+	{
+		InferenceFrameStats stats;
+
+		k_spinlock_key_t key = k_spin_lock(&m_statsLock);
+
+		stats = m_frameStats;
+		k_spin_unlock(&m_statsLock, key);
+
+		m_pump.GetCounts(stats.captured, stats.dropped);
+
+		return stats;
+	}
+
+	/**
+	 * @brief Snapshot of per-stage timing statistics, safe to call from any thread.
+	 */
+	InferenceStats GetStats(void)
+	{
+		InferenceStats stats = {};
+
+		k_spinlock_key_t key = k_spin_lock(&m_statsLock);
+
+		stats.inferences = m_inferences;
+		stats.failures = m_failures;
+		for (size_t i = 0; i < NumStages; i++) {
+			stats.stages[i] = m_stages[i].Get(m_inferences);
+		}
+		k_spin_unlock(&m_statsLock, key);
+
+		stats.frames = GetFrameStats();
+
+		return stats;
+	}
+
+	/**
+	 * @brief Clear timing statistics. Frame capture/drop counters are not affected.
+	 */
+	void ResetStats(void)
+	{
+		k_spinlock_key_t key = k_spin_lock(&m_statsLock);
 
-		k_thread_create(&m_inferenceThread, m_stack, K_THREAD_STACK_SIZEOF(m_stack),
-				ThreadEntry, this, NULL, NULL, ThreadPriority, 0, K_NO_WAIT);
+		m_inferences = 0;
+		m_failures = 0;
+		for (size_t i = 0; i < NumStages; i++) {
+			m_stages[i] = {};
+		}
+		k_spin_unlock(&m_statsLock, key);
 	}
 
 private:
+	static constexpr size_t NumStages = static_cast<size_t>(InferenceStage::Count);
+
+	using StageClock = inference_runner_detail::StageClock;
+
 	static void ThreadEntry(void *ctx, void *, void *)
 	{
 		static_cast<InferenceRunner *>(ctx)->Run();
@@ -104,49 +679,199 @@ private:
 
 	void Run(void)
 	{
-		if (!m_model.Init()) {
-			return;
+		const bool initialized = m_model.Init();
+
+		while (true) {
+			k_sem_take(&m_startSem, K_FOREVER);
+
+			if (m_exit) {
+				break;
+			}
+
+			if (initialized) {
+				RunLoop();
+			} else {
+				SetStatus(InferenceRunnerStatus::ModelInitFailed);
+			}
+
+			/* Also reached on failures, so Start() works again without a Stop() */
+			k_mutex_lock(&m_ctlLock, K_FOREVER);
+			m_active = false;
+			m_stopping = false;
+			atomic_clear(&m_running);
+			k_condvar_broadcast(&m_idleCond);
+			k_mutex_unlock(&m_ctlLock);
 		}
+	}
 
+	void RunLoop(void)
+	{
 		if (!m_input.Start()) {
+			SetStatus(InferenceRunnerStatus::InputStartFailed);
 			return;
 		}
 
-		while (true) {
-			if (k_sem_take(&m_inferenceSem, K_NO_WAIT) == 0) {
-				break;
-			}
+		atomic_set(&m_inputActive, 1);
+
+		if (!m_pump.Start(&m_input)) {
+			SetStatus(InferenceRunnerStatus::InputPumpFailed);
+			StopInput();
+			return;
+		}
 
-			if (!m_input.GetInputData(m_model.GetInputBuffer())) {
+		while (k_sem_take(&m_stopSem, K_NO_WAIT) != 0) {
+			if (!RunIteration()) {
 				break;
 			}
+		}
 
-			if (!m_model.PreProcess()) {
-				break;
+		StopInput();
+		m_pump.Stop();
+	}
+
+	bool RunIteration(void)
+	{
+		StageClock clock[NumStages + 1];
+		uint32_t timestamp;
+		uint32_t sequence;
+
+		clock[0] = StageClock::Now();
+
+		if (!m_pump.Acquire(m_model.GetInputBuffer(), timestamp, sequence)) {
+			/* Aborted reads are expected when stopping, not a failure */
+			if (atomic_get(&m_inputActive)) {
+				SetStatus(InferenceRunnerStatus::InputEnded);
 			}
+			return false;
+		}
 
+		clock[1] = StageClock::Now();
+		InferenceRunnerStatus failed = InferenceRunnerStatus::Ok;
+
+		if (!m_model.PreProcess()) {
+			failed = InferenceRunnerStatus::PreProcessFailed;
+		}
+
+		if (failed == InferenceRunnerStatus::Ok) {
+			clock[2] = StageClock::Now();
 			if (!m_model.RunInference()) {
-				break;
+				failed = InferenceRunnerStatus::InferenceFailed;
 			}
+		}
 
+		if (failed == InferenceRunnerStatus::Ok) {
+			clock[3] = StageClock::Now();
 			if (!m_model.PostProcess()) {
-				break;
+				failed = InferenceRunnerStatus::PostProcessFailed;
 			}
+		}
+
+		if (failed != InferenceRunnerStatus::Ok) {
+			SetStatus(failed);
+
+			k_spinlock_key_t key = k_spin_lock(&m_statsLock);
+
+			m_failures++;
+			k_spin_unlock(&m_statsLock, key);
+
+			return false;
+		}
+
+		clock[4] = StageClock::Now();
 
+		const InferenceFrameInfo info = {
+			.sequence = sequence,
+			.latencyUs = k_cyc_to_us_floor32(clock[4].cycles - timestamp),
+		};
+
+		UpdateFrameStats(info);
+
+		if constexpr (inference_runner_detail::AcceptsFrameInfo<OutputHandler,
+									 Result>::value) {
+			m_outputHandler.ProcessOutput(m_model.GetResult(), info);
+		} else {
 			m_outputHandler.ProcessOutput(m_model.GetResult());
 		}
 
-		m_input.Stop();
+		clock[5] = StageClock::Now();
+
+		UpdateStageStats(clock);
+
+		return true;
+	}
+
+	void SetStatus(InferenceRunnerStatus status)
+	{
+		atomic_set(&m_status, static_cast<atomic_val_t>(status));
+	}
+
+	/* Called from both the caller of Stop() and the inference thread, only one stops the input */
+	void StopInput(void)
+	{
+		if (atomic_cas(&m_inputActive, 1, 0)) {
+			m_input.Stop();
+		}
+	}
+
+	void UpdateStageStats(const StageClock (&clock)[NumStages + 1])
+	{
+		k_spinlock_key_t key = k_spin_lock(&m_statsLock);
+
+		for (size_t i = 0; i < NumStages; i++) {
+			const uint32_t us = k_cyc_to_us_floor32(clock[i + 1].cycles - clock[i].cycles);
+			const uint32_t cpuUs = static_cast<uint32_t>(
+				k_cyc_to_us_floor64(clock[i + 1].cpuCycles - clock[i].cpuCycles));
+
+			m_stages[i].Add(us, cpuUs, m_inferences == 0);
+		}
+		m_inferences++;
+		k_spin_unlock(&m_statsLock, key);
+	}
+
+	void UpdateFrameStats(const InferenceFrameInfo &info)
+	{
+		k_spinlock_key_t key = k_spin_lock(&m_statsLock);
+
+		if (m_frameStats.results == 0 || info.latencyUs < m_frameStats.minLatencyUs) {
+			m_frameStats.minLatencyUs = info.latencyUs;
+		}
+		if (info.latencyUs > m_frameStats.maxLatencyUs) {
+			m_frameStats.maxLatencyUs = info.latencyUs;
+		}
+		m_frameStats.lastLatencyUs = info.latencyUs;
+		m_frameStats.sumLatencyUs += info.latencyUs;
+		m_frameStats.results++;
+		k_spin_unlock(&m_statsLock, key);
 	}
 
 private:
+	using Result = std::decay_t<decltype(std::declval<Model &>().GetResult())>;
+
 	Model m_model;
 	Input m_input;
 	OutputHandler m_outputHandler;
+	inference_runner_detail::InputPump<Input, InputPolicy, InputQueueDepth, InputStackSize,
+					   inference_runner_detail::CapturePriority(ThreadPriority)>
+		m_pump;
+	InferenceFrameStats m_frameStats = {};
+	inference_runner_detail::StageAccumulator m_stages[NumStages] = {};
+	uint32_t m_inferences = 0;
+	uint32_t m_failures = 0;
+	struct k_spinlock m_statsLock;
 	K_KERNEL_STACK_MEMBER(m_stack, StackSize);
 	struct k_thread m_inferenceThread;
-	struct k_sem m_inferenceSem;
-	bool m_started = false;
+	struct k_sem m_startSem;
+	struct k_sem m_stopSem;
+	/* Guards m_active and m_stopping; m_idleCond is signalled when the loop parks */
+	struct k_mutex m_ctlLock;
+	struct k_condvar m_idleCond;
+	bool m_active = false;
+	bool m_stopping = false;
+	atomic_t m_inputActive = ATOMIC_INIT(0);
+	atomic_t m_running = ATOMIC_INIT(0);
+	atomic_t m_status = ATOMIC_INIT(0);
+	bool m_threadCreated = false;
+	volatile bool m_exit = false;
 };
 
 #endif /* INFERENCERUNNER_H */
@@ -0,0 +1,61 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+#ifndef FEATURE_NORMALISE_HPP
+#define FEATURE_NORMALISE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /**
+     * @brief       Converts quantised features to float: dst = (src - zeroPoint) * scale.
+     * @param[in]   src         Quantised features.
+     * @param[out]  dst         Float features, may not alias src.
+     * @param[in]   count       Number of features.
+     * @param[in]   scale       Quantisation scale.
+     * @param[in]   zeroPoint   Quantisation zero point.
+     */
+    void DequantiseFeatures(const uint8_t* src, float* dst, size_t count,
+                            float scale, int zeroPoint);
+
+    /** @copydoc DequantiseFeatures */
+    void DequantiseFeatures(const int8_t* src, float* dst, size_t count,
+                            float scale, int zeroPoint);
+
+    /**
+     * @brief       Quantises float features with rounding and saturation:
+     *              dst = clamp(round(src / scale) + zeroPoint).
+     * @param[in]   src         Float features.
+     * @param[out]  dst         Quantised features.
+     * @param[in]   count       Number of features.
+     * @param[in]   scale       Quantisation scale.
+     * @param[in]   zeroPoint   Quantisation zero point.
+     */
+    void QuantiseFeatures(const float* src, uint8_t* dst, size_t count,
+                          float scale, int zeroPoint);
+
+    /** @copydoc QuantiseFeatures */
+    void QuantiseFeatures(const float* src, int8_t* dst, size_t count,
+                          float scale, int zeroPoint);
+
+    /**
+     * @brief           Normalises features in place to zero mean and unit variance.
+     * @param[in,out]   features   Features to normalise.
+     * @param[in]       count      Number of features.
+     */
+    void StandardiseFeatures(float* features, size_t count);
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* FEATURE_NORMALISE_HPP */
@@ -99,16 +99,42 @@ namespace audio {
         std::vector<T> MfccComputeQuant(const std::vector<int16_t>& audioData,
                                         const float quantScale,
                                         const int quantOffset)
+        {
+            std::vector<T> mfccOut(this->m_params.m_numMfccFeatures);
+            this->MfccComputeQuant<T>(audioData.data(), quantScale, quantOffset, mfccOut.data());
+            return mfccOut;
+        }
+
+        /**
+        * @brief        Extract MFCC features for one frame of audio data
+        *               without allocating, for streaming use.
+        * @param[in]    audioData   Pointer to m_frameLen audio samples.
+        * @param[out]   mfccOut     Destination for m_numMfccFeatures features.
+        **/
+        void MfccCompute(const int16_t* audioData, float* mfccOut);
+
+        /**
+        * @brief        Extract and quantise MFCC features for one frame of
+        *               audio data without allocating, for streaming use.
+        * @param[in]    audioData     Pointer to m_frameLen audio samples.
+        * @param[in]    quantScale    Quantisation scale.
+        * @param[in]    quantOffset   Quantisation offset.
+        * @param[out]   mfccOut       Destination for m_numMfccFeatures features.
+        **/
+        template<typename T>
+        void MfccComputeQuant(const int16_t* audioData,
+                              const float quantScale,
+                              const int quantOffset,
+                              T* mfccOut)
         {
             this->MfccComputePreFeature(audioData);
             float minVal = std::numeric_limits<T>::min();
             float maxVal = std::numeric_limits<T>::max();
 
-            std::vector<T> mfccOut(this->m_params.m_numMfccFeatures);
             const size_t numFbankBins = this->m_params.m_numFbankBins;
 
             /* Take DCT. Uses matrix mul. */
-            for (size_t i = 0, j = 0; i < mfccOut.size(); ++i, j += numFbankBins) {
+            for (size_t i = 0, j = 0; i < this->m_params.m_numMfccFeatures; ++i, j += numFbankBins) {
 
                 float sum = math::MathUtils::DotProductF32(this->m_dctMatrix.data() + j, this->m_melEnergies.data(), numFbankBins);
 
@@ -116,8 +142,6 @@ namespace audio {
                 sum = std::round((sum / quantScale) + quantOffset);
                 mfccOut[i] = static_cast<T>(std::min<float>(std::max<float>(sum, minVal), maxVal));
             }
-
-            return mfccOut;
         }
 
         /* Constants */
@@ -126,7 +150,6 @@ namespace audio {
         static constexpr float ms_minLogHz = 1000.0;
         static constexpr float ms_minLogMel = ms_minLogHz / ms_freqStep;
 
-    protected:
         /**
          * @brief       Project input frequency to Mel Scale.
          * @param[in]   freq           Input frequency in floating point.
@@ -148,6 +171,7 @@ namespace audio {
         static float InverseMelScale(float melFreq,
                                      bool  useHTKMethod = true);
 
+    protected:
         /**
          * @brief       Populates MEL energies after applying the MEL filter
          *              bank weights and adding them up to be placed into
@@ -238,9 +262,9 @@ namespace audio {
         /**
          * @brief       Computes and populates internal memeber buffers used
          *              in MFCC feature calculation
-         * @param[in]   audioData   1D vector of 16-bit audio data.
+         * @param[in]   audioData   Pointer to m_frameLen 16-bit audio samples.
          */
-        void MfccComputePreFeature(const std::vector<int16_t>& audioData);
+        void MfccComputePreFeature(const int16_t* audioData);
 
         /** @brief       Computes the magnitude from an interleaved complex array. */
         void ConvertToPowerSpectrum();
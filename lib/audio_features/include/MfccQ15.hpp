@@ -0,0 +1,125 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+#ifndef MFCC_Q15_HPP
+#define MFCC_Q15_HPP
+
+#include "Mfcc.hpp"
+
+#include "arm_math.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace arm {
+namespace app {
+namespace audio {
+
+    /**
+     * @brief   Fixed-point MFCC feature extraction.
+     *          Produces the same features as MFCC (HTK mel scale, Hann window, magnitude
+     *          spectrum, natural log, orthonormal DCT-II) with a CMSIS-DSP Q15 real FFT.
+     *          The mel filter bank is stored packed: one Q15 weight array with the first
+     *          FFT bin and weight count of each mel bin, so no per-bin vectors are walked.
+     *          Mel energies and the DCT are accumulated in 64 bits and the log is taken in
+     *          fixed point. The frame is scaled up to use the full Q15 range before the FFT
+     *          and the scale is removed in the log domain, so quiet input keeps precision.
+     *          Floating point is only used in the constructor to build the tables.
+     */
+    class MfccQ15 {
+    public:
+        /**
+         * @brief       Constructor
+         * @param[in]   params   MFCC parameters, m_frameLenPadded must be supported by
+         *                       arm_rfft_init_q15 (32 to 8192).
+         */
+        explicit MfccQ15(const MfccParams& params);
+
+        MfccQ15() = delete;
+
+        ~MfccQ15() = default;
+
+        /** @brief  Initialise. Kept for interface compatibility with MFCC. */
+        void Init();
+
+        /**
+         * @brief        Extract MFCC features for one frame of audio data.
+         * @param[in]    audioData   Pointer to m_frameLen audio samples.
+         * @param[out]   mfccOut     Destination for m_numMfccFeatures features.
+         **/
+        void MfccCompute(const int16_t* audioData, float* mfccOut);
+
+        /**
+         * @brief        Extract and quantise MFCC features for one frame of audio data.
+         * @param[in]    audioData     Pointer to m_frameLen audio samples.
+         * @param[in]    quantScale    Quantisation scale.
+         * @param[in]    quantOffset   Quantisation offset.
+         * @param[out]   mfccOut       Destination for m_numMfccFeatures features.
+         **/
+        template<typename T>
+        void MfccComputeQuant(const int16_t* audioData,
+                              const float quantScale,
+                              const int quantOffset,
+                              T* mfccOut)
+        {
+            this->MfccComputeLogMel(audioData);
+
+            /* 1/scale in Q16, features are Q16 after the DCT shift. */
+            const int64_t invScale = static_cast<int64_t>(65536.f / quantScale + 0.5f);
+            const int64_t minVal = std::numeric_limits<T>::min();
+            const int64_t maxVal = std::numeric_limits<T>::max();
+
+            for (uint32_t i = 0; i < this->m_params.m_numMfccFeatures; ++i) {
+                const int64_t feature = this->DctRow(i) >> ms_dctShift;
+                int64_t q = ((feature * invScale + (INT64_C(1) << 31)) >> 32) + quantOffset;
+
+                q = q < minVal ? minVal : (q > maxVal ? maxVal : q);
+                mfccOut[i] = static_cast<T>(q);
+            }
+        }
+
+    private:
+        /* Log-mel energies are Q16, the DCT matrix is Q15, so DCT sums are Q31. */
+        static constexpr int ms_logFracBits = 16;
+        static constexpr int ms_dctShift = 15;
+        static constexpr int ms_log2LutBits = 5;
+
+        MfccParams                  m_params;
+        arm_rfft_instance_q15       m_rfft;
+        int                         m_fftLenLog2;
+        std::vector<q15_t>          m_window;
+        std::vector<q15_t>          m_frame;
+        std::vector<q15_t>          m_spectrum;     /* Interleaved complex FFT output. */
+        std::vector<q15_t>          m_magnitude;    /* 2.14 magnitudes of bins 0..N/2. */
+        std::vector<q15_t>          m_melWeights;   /* Packed weights of all mel bins. */
+        std::vector<uint16_t>       m_melFirst;     /* First FFT bin of each mel bin. */
+        std::vector<uint16_t>       m_melCount;     /* Number of weights of each mel bin. */
+        std::vector<int32_t>        m_logMel;       /* Q16 natural log of mel energies. */
+        std::vector<q15_t>          m_dctMatrix;
+        std::vector<int32_t>        m_log2Lut;      /* Q16 log2(1 + i / 2^ms_log2LutBits). */
+        int32_t                     m_logFloor;     /* Q16 log used for an empty mel bin. */
+
+        /** @brief  Builds the packed mel filter bank from the float weights. */
+        void InitMelFilterBank();
+
+        /** @brief  Q16 log2 of a non-zero integer. */
+        int32_t Log2Q16(uint64_t value) const;
+
+        /** @brief  Computes m_logMel for one frame of audio. */
+        void MfccComputeLogMel(const int16_t* audioData);
+
+        /** @brief  Q31 DCT output for one feature. */
+        int64_t DctRow(uint32_t row) const;
+    };
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
+
+#endif /* MFCC_Q15_HPP */
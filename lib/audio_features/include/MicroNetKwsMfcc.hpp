@@ -18,6 +18,9 @@
 #define KWS_MICRONET_MFCC_HPP
 
 #include "Mfcc.hpp"
+#if defined(AUDIO_FEATURES_Q15)
+#include "MfccQ15.hpp"
+#endif
 
 namespace arm {
 namespace app {
@@ -43,8 +46,26 @@ namespace audio {
         ~MicroNetKwsMFCC() = default;
     };
 
+#if defined(AUDIO_FEATURES_Q15)
+    /* Fixed-point variant of MicroNetKwsMFCC with the same parameters. */
+    class MicroNetKwsMFCCQ15 : public MfccQ15 {
+
+    public:
+        explicit MicroNetKwsMFCCQ15(const size_t numFeats, const size_t frameLen)
+            :  MfccQ15(MfccParams(
+                        MicroNetKwsMFCC::ms_defaultSamplingFreq,
+                        MicroNetKwsMFCC::ms_defaultNumFbankBins,
+                        MicroNetKwsMFCC::ms_defaultMelLoFreq,
+                        MicroNetKwsMFCC::ms_defaultMelHiFreq,
+                        numFeats, frameLen, MicroNetKwsMFCC::ms_defaultUseHtkMethod))
+        {}
+        MicroNetKwsMFCCQ15()  = delete;
+        ~MicroNetKwsMFCCQ15() = default;
+    };
+#endif /* AUDIO_FEATURES_Q15 */
+
 } /* namespace audio */
 } /* namespace app */
 } /* namespace arm */
 
-#endif /* KWS_MICRONET_MFCC_HPP */
\ No newline at end of file
+#endif /* KWS_MICRONET_MFCC_HPP */
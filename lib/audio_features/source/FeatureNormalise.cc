@@ -0,0 +1,82 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+#include "FeatureNormalise.hpp"
+#include "PlatformMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm
+{
+namespace app
+{
+namespace audio
+{
+
+template <typename T>
+static void Dequantise(const T *src, float *dst, size_t count, float scale, int zeroPoint)
+{
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = static_cast<float>(static_cast<int>(src[i]) - zeroPoint) * scale;
+	}
+}
+
+template <typename T>
+static void Quantise(const float *src, T *dst, size_t count, float scale, int zeroPoint)
+{
+	const float invScale = 1.f / scale;
+	const float minVal = std::numeric_limits<T>::min();
+	const float maxVal = std::numeric_limits<T>::max();
+
+	for (size_t i = 0; i < count; i++) {
+		const float q = std::round(src[i] * invScale) + zeroPoint;
+
+		dst[i] = static_cast<T>(std::min(std::max(q, minVal), maxVal));
+	}
+}
+
+void DequantiseFeatures(const uint8_t *src, float *dst, size_t count, float scale, int zeroPoint)
+{
+	Dequantise(src, dst, count, scale, zeroPoint);
+}
+
+void DequantiseFeatures(const int8_t *src, float *dst, size_t count, float scale, int zeroPoint)
+{
+	Dequantise(src, dst, count, scale, zeroPoint);
+}
+
+void QuantiseFeatures(const float *src, uint8_t *dst, size_t count, float scale, int zeroPoint)
+{
+	Quantise(src, dst, count, scale, zeroPoint);
+}
+
+void QuantiseFeatures(const float *src, int8_t *dst, size_t count, float scale, int zeroPoint)
+{
+	Quantise(src, dst, count, scale, zeroPoint);
+}
+
+void StandardiseFeatures(float *features, size_t count)
+{
+	if (count == 0) {
+		return;
+	}
+
+	const float mean = math::MathUtils::MeanF32(features, static_cast<uint32_t>(count));
+	const float stdDev = math::MathUtils::StdDevF32(features, static_cast<uint32_t>(count), mean);
+	const float invStdDev = stdDev > 0.f ? 1.f / stdDev : 1.f;
+
+	for (size_t i = 0; i < count; i++) {
+		features[i] = (features[i] - mean) * invStdDev;
+	}
+}
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
@@ -207,7 +207,7 @@ bool MFCC::IsMelFilterBankInited() const
 	return this->m_filterBankInitialised;
 }
 
-void MFCC::MfccComputePreFeature(const std::vector<int16_t> &audioData)
+void MFCC::MfccComputePreFeature(const int16_t *audioData)
 {
 	this->InitMelFilterBank();
 
@@ -244,20 +244,26 @@ void MFCC::MfccComputePreFeature(const std::vector<int16_t> &audioData)
 
 std::vector<float> MFCC::MfccCompute(const std::vector<int16_t> &audioData)
 {
-	this->MfccComputePreFeature(audioData);
-
 	std::vector<float> mfccOut(this->m_params.m_numMfccFeatures);
 
+	this->MfccCompute(audioData.data(), mfccOut.data());
+
+	return mfccOut;
+}
+
+void MFCC::MfccCompute(const int16_t *audioData, float *mfccOut)
+{
+	this->MfccComputePreFeature(audioData);
+
 	float *ptrMel = this->m_melEnergies.data();
 	float *ptrDct = this->m_dctMatrix.data();
-	float *ptrMfcc = mfccOut.data();
 
 	/* Take DCT. Uses matrix mul. */
-	for (size_t i = 0, j = 0; i < mfccOut.size(); ++i, j += this->m_params.m_numFbankBins) {
-		*ptrMfcc++ = math::MathUtils::DotProductF32(ptrDct + j, ptrMel,
+	for (size_t i = 0, j = 0; i < this->m_params.m_numMfccFeatures;
+	     ++i, j += this->m_params.m_numFbankBins) {
+		*mfccOut++ = math::MathUtils::DotProductF32(ptrDct + j, ptrMel,
 							    this->m_params.m_numFbankBins);
 	}
-	return mfccOut;
 }
 
 std::vector<std::vector<float>> MFCC::CreateMelFilterBank()
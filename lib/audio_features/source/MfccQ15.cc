@@ -0,0 +1,230 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+#include "MfccQ15.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cinttypes>
+#include <cmath>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(MfccQ15);
+
+namespace arm
+{
+namespace app
+{
+namespace audio
+{
+
+/* ln(2) in Q16. */
+static constexpr int64_t kLn2Q16 = 45426;
+
+static q15_t FloatToQ15(float value)
+{
+	const long q = lrintf(value * 32768.f);
+
+	return static_cast<q15_t>(std::min<long>(std::max<long>(q, INT16_MIN), INT16_MAX));
+}
+
+MfccQ15::MfccQ15(const MfccParams &params)
+	: m_params(params), m_fftLenLog2(0), m_logFloor(0)
+{
+	const uint32_t fftLen = this->m_params.m_frameLenPadded;
+
+	while ((1u << this->m_fftLenLog2) < fftLen) {
+		++this->m_fftLenLog2;
+	}
+
+	if (ARM_MATH_SUCCESS != arm_rfft_init_q15(&this->m_rfft, fftLen, 0, 1)) {
+		LOG_ERR("Failed to initialise Q15 RFFT for len %" PRIu32, fftLen);
+	}
+
+	this->m_frame = std::vector<q15_t>(fftLen, 0);
+	this->m_spectrum = std::vector<q15_t>(2 * fftLen, 0);
+	this->m_magnitude = std::vector<q15_t>(fftLen / 2 + 1, 0);
+	this->m_logMel = std::vector<int32_t>(this->m_params.m_numFbankBins, 0);
+
+	/* Hann window, same as MFCC. */
+	this->m_window = std::vector<q15_t>(this->m_params.m_frameLen);
+	const auto multiplier = static_cast<float>(2 * M_PI / this->m_params.m_frameLen);
+	for (size_t i = 0; i < this->m_params.m_frameLen; i++) {
+		this->m_window[i] = FloatToQ15(0.5f - 0.5f * cosf(static_cast<float>(i) * multiplier));
+	}
+
+	/* Orthonormal DCT-II, same as MFCC::CreateDCTMatrix. */
+	const uint32_t numBins = this->m_params.m_numFbankBins;
+	const float normaliser = sqrtf(2.0f / numBins);
+	this->m_dctMatrix = std::vector<q15_t>(numBins * this->m_params.m_numMfccFeatures);
+	for (uint32_t k = 0; k < this->m_params.m_numMfccFeatures; k++) {
+		for (uint32_t n = 0; n < numBins; n++) {
+			this->m_dctMatrix[k * numBins + n] = FloatToQ15(
+				normaliser * cosf(static_cast<float>(M_PI) / numBins * (n + 0.5f) * k));
+		}
+	}
+
+	this->m_log2Lut = std::vector<int32_t>((1u << ms_log2LutBits) + 1);
+	for (size_t i = 0; i < this->m_log2Lut.size(); i++) {
+		this->m_log2Lut[i] = static_cast<int32_t>(
+			lrintf(log2f(1.f + static_cast<float>(i) / (1u << ms_log2LutBits)) *
+			       (1 << ms_logFracBits)));
+	}
+
+	/* MFCC starts every mel energy at FLT_MIN, use its log for empty bins so silence
+	 * produces the same features. */
+	this->m_logFloor = static_cast<int32_t>(lrintf(logf(FLT_MIN) * (1 << ms_logFracBits)));
+
+	this->InitMelFilterBank();
+	this->m_params.Log();
+}
+
+void MfccQ15::Init()
+{
+}
+
+void MfccQ15::InitMelFilterBank()
+{
+	const uint32_t numBins = this->m_params.m_numFbankBins;
+	const size_t numFftBins = this->m_params.m_frameLenPadded / 2;
+	const float fftBinWidth =
+		static_cast<float>(this->m_params.m_samplingFreq) / this->m_params.m_frameLenPadded;
+	const bool htk = this->m_params.m_useHtkMethod;
+
+	const float melLowFreq = MFCC::MelScale(this->m_params.m_melLoFreq, htk);
+	const float melHighFreq = MFCC::MelScale(this->m_params.m_melHiFreq, htk);
+	const float melFreqDelta = (melHighFreq - melLowFreq) / (numBins + 1);
+
+	this->m_melFirst = std::vector<uint16_t>(numBins, 0);
+	this->m_melCount = std::vector<uint16_t>(numBins, 0);
+	this->m_melWeights.clear();
+
+	for (uint32_t bin = 0; bin < numBins; bin++) {
+		const float leftMel = melLowFreq + bin * melFreqDelta;
+		const float centerMel = melLowFreq + (bin + 1) * melFreqDelta;
+		const float rightMel = melLowFreq + (bin + 2) * melFreqDelta;
+		bool firstIndexFound = false;
+
+		for (size_t i = 0; i < numFftBins; i++) {
+			const float mel = MFCC::MelScale(fftBinWidth * i, htk);
+
+			if (mel <= leftMel || mel >= rightMel) {
+				continue;
+			}
+
+			const float weight = mel <= centerMel
+						     ? (mel - leftMel) / (centerMel - leftMel)
+						     : (rightMel - mel) / (rightMel - centerMel);
+
+			if (!firstIndexFound) {
+				this->m_melFirst[bin] = i;
+				firstIndexFound = true;
+			}
+
+			/* Bins are contiguous, so the count is enough to find the last one. */
+			this->m_melWeights.push_back(FloatToQ15(weight));
+			this->m_melCount[bin]++;
+		}
+	}
+
+	this->m_melWeights.shrink_to_fit();
+}
+
+int32_t MfccQ15::Log2Q16(uint64_t value) const
+{
+	const int msb = 63 - __builtin_clzll(value);
+
+	/* Mantissa bits below the leading one as a Q32 fraction. */
+	const uint32_t frac = msb >= 32 ? static_cast<uint32_t>(value >> (msb - 32))
+					: static_cast<uint32_t>(value << (32 - msb));
+	const uint32_t idx = frac >> (32 - ms_log2LutBits);
+	const int64_t t = (frac << ms_log2LutBits) >> 16;
+	const int32_t lo = this->m_log2Lut[idx];
+	const int32_t hi = this->m_log2Lut[idx + 1];
+
+	return (msb << ms_logFracBits) + lo + static_cast<int32_t>(((hi - lo) * t) >> 16);
+}
+
+void MfccQ15::MfccComputeLogMel(const int16_t *audioData)
+{
+	const uint32_t frameLen = this->m_params.m_frameLen;
+	const uint32_t numBins = this->m_params.m_numFbankBins;
+
+	arm_mult_q15(audioData, this->m_window.data(), this->m_frame.data(), frameLen);
+	std::fill(this->m_frame.begin() + frameLen, this->m_frame.end(), 0);
+
+	int32_t maxAbs = 0;
+	for (uint32_t i = 0; i < frameLen; i++) {
+		maxAbs = std::max<int32_t>(maxAbs, std::abs(static_cast<int32_t>(this->m_frame[i])));
+	}
+
+	if (maxAbs == 0) {
+		std::fill(this->m_logMel.begin(), this->m_logMel.end(), this->m_logFloor);
+		return;
+	}
+
+	/* Use the full Q15 range, the RFFT scales down by 2 in every stage. */
+	const int headroom = std::max(__builtin_clz(static_cast<uint32_t>(maxAbs)) - 17, 0);
+	if (headroom > 0) {
+		arm_shift_q15(this->m_frame.data(), headroom, this->m_frame.data(), frameLen);
+	}
+
+	arm_rfft_q15(&this->m_rfft, this->m_frame.data(), this->m_spectrum.data());
+	arm_cmplx_mag_q15(this->m_spectrum.data(), this->m_magnitude.data(),
+			  this->m_magnitude.size());
+
+	/* The RFFT output is the spectrum divided by 2^log2(N) in Q15 and the magnitude is
+	 * 2.14, so sum(weight * magnitude) is the mel energy in units of
+	 * 2^(log2(N) - 29), before undoing the headroom shift. */
+	const int32_t exponent = (this->m_fftLenLog2 - 29 - headroom) << ms_logFracBits;
+	const q15_t *weight = this->m_melWeights.data();
+
+	for (uint32_t bin = 0; bin < numBins; bin++) {
+		const q15_t *magnitude = this->m_magnitude.data() + this->m_melFirst[bin];
+		int64_t acc = 0;
+
+		for (uint32_t i = 0; i < this->m_melCount[bin]; i++) {
+			acc += static_cast<int32_t>(*weight++) * magnitude[i];
+		}
+
+		if (acc <= 0) {
+			this->m_logMel[bin] = this->m_logFloor;
+			continue;
+		}
+
+		const int64_t log2Energy = this->Log2Q16(static_cast<uint64_t>(acc)) + exponent;
+		this->m_logMel[bin] = static_cast<int32_t>((log2Energy * kLn2Q16) >> 16);
+	}
+}
+
+int64_t MfccQ15::DctRow(uint32_t row) const
+{
+	const uint32_t numBins = this->m_params.m_numFbankBins;
+	const q15_t *dct = this->m_dctMatrix.data() + row * numBins;
+	int64_t acc = 0;
+
+	for (uint32_t n = 0; n < numBins; n++) {
+		acc += static_cast<int64_t>(dct[n]) * this->m_logMel[n];
+	}
+
+	return acc;
+}
+
+void MfccQ15::MfccCompute(const int16_t *audioData, float *mfccOut)
+{
+	this->MfccComputeLogMel(audioData);
+
+	for (uint32_t i = 0; i < this->m_params.m_numMfccFeatures; ++i) {
+		mfccOut[i] = static_cast<float>(this->DctRow(i)) /
+			     static_cast<float>(INT64_C(1) << (ms_logFracBits + ms_dctShift));
+	}
+}
+
+} /* namespace audio */
+} /* namespace app */
+} /* namespace arm */
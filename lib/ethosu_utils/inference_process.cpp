@@ -130,6 +130,11 @@ bool InferenceProcess::runJob(InferenceJob &job)
 		return true;
 	}
 
+	arenaUsedBytes = interpreter.arena_used_bytes();
+	if (arenaUsedBytes > arenaPeakBytes) {
+		arenaPeakBytes = arenaUsedBytes;
+	}
+
 	if (job.input.size() != interpreter.inputs_size()) {
 		printk("Number of job and network inputs do not match. input=%zu, network=%zu\n",
 		       job.input.size(), interpreter.inputs_size());
@@ -49,8 +49,22 @@ class InferenceProcess {
 
 	bool runJob(InferenceJob &job);
 
+	/* Arena bytes used by the last job after AllocateTensors(), 0 before the first job */
+	size_t getArenaUsedBytes() const
+	{
+		return arenaUsedBytes;
+	}
+
+	/* Largest getArenaUsedBytes() seen across all jobs */
+	size_t getArenaPeakBytes() const
+	{
+		return arenaPeakBytes;
+	}
+
     private:
 	uint8_t *tensorArena;
 	const size_t tensorArenaSize;
+	size_t arenaUsedBytes = 0;
+	size_t arenaPeakBytes = 0;
 };
 } /* namespace InferenceProcess */
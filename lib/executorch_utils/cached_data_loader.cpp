@@ -0,0 +1,263 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "cached_data_loader.h"
+
+#include <executorch/runtime/platform/log.h>
+#include <zephyr/drivers/flash.h>
+#include <cstring>
+
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+
+namespace alif {
+namespace executorch_utils {
+
+namespace {
+// Ethos-U command streams and weights must be 16 byte aligned
+constexpr size_t kSegmentAlignment = 16;
+} // namespace
+
+CachedDataLoader::CachedDataLoader(
+    const void* data,
+    size_t size,
+    uint8_t* cache,
+    size_t cache_size)
+    : data_(static_cast<const uint8_t*>(data)),
+      flash_(nullptr),
+      flash_offset_(0),
+      size_(size) {
+  init_cache(cache, cache_size);
+}
+
+CachedDataLoader::CachedDataLoader(
+    const struct device* flash,
+    off_t offset,
+    size_t size,
+    uint8_t* cache,
+    size_t cache_size)
+    : data_(nullptr), flash_(flash), flash_offset_(offset), size_(size) {
+  init_cache(cache, cache_size);
+}
+
+void CachedDataLoader::init_cache(uint8_t* cache, size_t cache_size) {
+  k_heap_init(&heap_, cache, cache_size);
+  k_mutex_init(&lock_);
+  memset(entries_, 0, sizeof(entries_));
+  stats_.cache_size = cache_size;
+
+  // The heap keeps its own headers in the buffer, find what is left for
+  // segments while it is still empty.
+  size_t lo = 0;
+  size_t hi = cache_size;
+
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo + 1) / 2;
+    void* probe =
+        k_heap_aligned_alloc(&heap_, kSegmentAlignment, mid, K_NO_WAIT);
+
+    if (probe != nullptr) {
+      k_heap_free(&heap_, probe);
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+
+  max_segment_ = lo;
+}
+
+Result<size_t> CachedDataLoader::size() const {
+  return size_;
+}
+
+CachedDataLoader::Entry* CachedDataLoader::find(size_t offset, size_t size)
+    const {
+  for (auto& entry : entries_) {
+    if (entry.valid && entry.offset == offset && entry.size >= size) {
+      return &entry;
+    }
+  }
+
+  return nullptr;
+}
+
+bool CachedDataLoader::evict_one() const {
+  Entry* victim = nullptr;
+
+  for (auto& entry : entries_) {
+    if (!entry.valid || entry.refs != 0) {
+      continue;
+    }
+    if (victim == nullptr || entry.last_use < victim->last_use) {
+      victim = &entry;
+    }
+  }
+
+  if (victim == nullptr) {
+    return false;
+  }
+
+  k_heap_free(&heap_, victim->data);
+  stats_.cache_used -= victim->size;
+  stats_.evictions++;
+  victim->valid = false;
+
+  return true;
+}
+
+CachedDataLoader::Entry* CachedDataLoader::allocate(size_t size) const {
+  Entry* slot = nullptr;
+
+  while (true) {
+    for (auto& entry : entries_) {
+      if (!entry.valid) {
+        slot = &entry;
+        break;
+      }
+    }
+
+    if (slot != nullptr) {
+      break;
+    }
+
+    if (!evict_one()) {
+      return nullptr;
+    }
+  }
+
+  void* data = nullptr;
+
+  while ((data = k_heap_aligned_alloc(
+              &heap_, kSegmentAlignment, size, K_NO_WAIT)) == nullptr) {
+    if (!evict_one()) {
+      return nullptr;
+    }
+  }
+
+  slot->data = data;
+  slot->size = size;
+  slot->refs = 0;
+  slot->valid = true;
+
+  stats_.cache_used += size;
+  if (stats_.cache_used > stats_.cache_peak) {
+    stats_.cache_peak = stats_.cache_used;
+  }
+
+  return slot;
+}
+
+int CachedDataLoader::read_source(size_t offset, void* dst, size_t size)
+    const {
+  if (data_ != nullptr) {
+    memcpy(dst, data_ + offset, size);
+    return 0;
+  }
+
+  return flash_read(flash_, flash_offset_ + offset, dst, size);
+}
+
+Result<FreeableBuffer> CachedDataLoader::load(
+    size_t offset,
+    size_t size,
+    const SegmentInfo& segment_info) const {
+  ET_CHECK_OR_RETURN_ERROR(
+      offset + size <= size_,
+      InvalidArgument,
+      "Segment offset %zu + size %zu exceeds model size %zu",
+      offset,
+      size,
+      size_);
+
+  k_mutex_lock(&lock_, K_FOREVER);
+
+  Entry* entry = find(offset, size);
+
+  if (entry != nullptr) {
+    stats_.hits++;
+  } else if (data_ != nullptr && size > max_segment_) {
+    stats_.bypasses++;
+    k_mutex_unlock(&lock_);
+    return FreeableBuffer(data_ + offset, size, nullptr);
+  } else {
+    stats_.misses++;
+    entry = allocate(size);
+
+    if (entry == nullptr) {
+      k_mutex_unlock(&lock_);
+      ET_LOG(
+          Error,
+          "Model cache full: segment %zu (type %d) needs %zu bytes",
+          segment_info.segment_index,
+          static_cast<int>(segment_info.segment_type),
+          size);
+      return Error::MemoryAllocationFailed;
+    }
+
+    int ret = read_source(offset, entry->data, size);
+
+    if (ret != 0) {
+      entry->valid = false;
+      k_heap_free(&heap_, entry->data);
+      stats_.cache_used -= size;
+      k_mutex_unlock(&lock_);
+      ET_LOG(Error, "Model read at offset %zu failed: %d", offset, ret);
+      return Error::AccessFailed;
+    }
+
+    entry->offset = offset;
+    stats_.bytes_loaded += size;
+  }
+
+  entry->refs++;
+  entry->last_use = ++use_clock_;
+  void* data = entry->data;
+
+  k_mutex_unlock(&lock_);
+
+  return FreeableBuffer(
+      data, size, release, const_cast<CachedDataLoader*>(this));
+}
+
+void CachedDataLoader::release(void* context, void* data, size_t size) {
+  auto* self = static_cast<CachedDataLoader*>(context);
+
+  ARG_UNUSED(size);
+
+  k_mutex_lock(&self->lock_, K_FOREVER);
+
+  for (auto& entry : self->entries_) {
+    if (entry.valid && entry.data == data && entry.refs > 0) {
+      entry.refs--;
+      break;
+    }
+  }
+
+  k_mutex_unlock(&self->lock_);
+}
+
+CachedDataLoader::Stats CachedDataLoader::stats() const {
+  k_mutex_lock(&lock_, K_FOREVER);
+  Stats stats = stats_;
+  k_mutex_unlock(&lock_);
+
+  return stats;
+}
+
+uint32_t CachedDataLoader::hit_rate() const {
+  Stats s = stats();
+  uint32_t total = s.hits + s.misses + s.bypasses;
+
+  return total == 0 ? 0 : (100 * s.hits) / total;
+}
+
+} // namespace executorch_utils
+} // namespace alif
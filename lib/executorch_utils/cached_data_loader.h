@@ -0,0 +1,117 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include <executorch/runtime/core/data_loader.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+namespace alif {
+namespace executorch_utils {
+
+/**
+ * DataLoader that keeps the .pte in external memory and copies segments into an
+ * SRAM cache on demand.
+ *
+ * The source is either memory mapped (OSPI XIP flash, PSRAM) or a flash device
+ * read through flash_read(), which uses the controller's DMA where available.
+ * Each load() is served from the cache when the same segment was loaded before,
+ * otherwise least recently used unreferenced segments are evicted until the new
+ * one fits. Segments stay cached after being freed, so reloading a method (e.g.
+ * after a pause) does not touch external memory again.
+ *
+ * A segment is pinned while its FreeableBuffer is alive. The Ethos-U delegate
+ * keeps its command stream and weights for the lifetime of the method, so each
+ * delegate segment must fit in the cache on its own. Memory mapped segments
+ * larger than the empty cache can hold (its size less the k_heap overhead) are
+ * handed out directly from the source ("bypass"), which requires the source to
+ * be readable by the NPU.
+ */
+class CachedDataLoader final : public executorch::runtime::DataLoader {
+ public:
+  static constexpr size_t kMaxEntries = 16;
+
+  struct Stats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bypasses;
+    size_t bytes_loaded; // Bytes copied from the source into the cache
+    size_t cache_size;
+    size_t cache_used;
+    size_t cache_peak;
+  };
+
+  /** Memory mapped source, e.g. a model linked into the XIP flash region. */
+  CachedDataLoader(
+      const void* data,
+      size_t size,
+      uint8_t* cache,
+      size_t cache_size);
+
+  /** Flash device source, the .pte is stored at @p offset. */
+  CachedDataLoader(
+      const struct device* flash,
+      off_t offset,
+      size_t size,
+      uint8_t* cache,
+      size_t cache_size);
+
+  CachedDataLoader(const CachedDataLoader&) = delete;
+  CachedDataLoader& operator=(const CachedDataLoader&) = delete;
+
+  ET_NODISCARD executorch::runtime::Result<executorch::runtime::FreeableBuffer>
+  load(size_t offset, size_t size, const SegmentInfo& segment_info)
+      const override;
+
+  ET_NODISCARD executorch::runtime::Result<size_t> size() const override;
+
+  Stats stats() const;
+
+  /** Hit rate in percent over all load() calls so far. */
+  uint32_t hit_rate() const;
+
+ private:
+  struct Entry {
+    size_t offset;
+    size_t size;
+    void* data;
+    uint32_t refs;
+    uint32_t last_use;
+    bool valid;
+  };
+
+  static void release(void* context, void* data, size_t size);
+
+  void init_cache(uint8_t* cache, size_t cache_size);
+  Entry* find(size_t offset, size_t size) const;
+  Entry* allocate(size_t size) const;
+  bool evict_one() const;
+  int read_source(size_t offset, void* dst, size_t size) const;
+
+  const uint8_t* data_;
+  const struct device* flash_;
+  off_t flash_offset_;
+  size_t size_;
+  size_t max_segment_; // Largest allocation the empty cache can satisfy
+
+  mutable struct k_heap heap_;
+  mutable struct k_mutex lock_;
+  mutable Entry entries_[kMaxEntries];
+  mutable uint32_t use_clock_ = 0;
+  mutable Stats stats_ = {};
+};
+
+} // namespace executorch_utils
+} // namespace alif
@@ -14,6 +14,34 @@
  */
 
 #include <aipl_video_alloc.h>
+
+#if defined(CONFIG_VIDEO_POOL)
+#include "video_pool/video_pool.h"
+
+/* The pool takes its blocks from the D0 heap, or from malloc when headless */
+void *aipl_video_alloc(uint32_t size)
+{
+	return video_pool_alloc(size);
+}
+
+void aipl_video_free(void *ptr)
+{
+	video_pool_free(ptr);
+}
+#elif defined(CONFIG_BENCHMARK_HEADLESS)
+#include <stdlib.h>
+
+/* No D/AVE2D heap without the GPU, the buffers are only touched by the CPU */
+void *aipl_video_alloc(uint32_t size)
+{
+	return malloc(size);
+}
+
+void aipl_video_free(void *ptr)
+{
+	free(ptr);
+}
+#else
 #include <dave_d0lib.h>
 
 void *aipl_video_alloc(uint32_t size)
@@ -25,3 +53,4 @@ void aipl_video_free(void *ptr)
 {
 	d0_freevidmem(ptr);
 }
+#endif
@@ -16,15 +16,32 @@
 #include "benchmark.h"
 #include "utmr.h"
 #include "cpu_usage.h"
+#include <math.h>
 #include <zephyr/sys/printk.h>
 
 benchmark_t benchmark_create(exec_wrap_func_t func)
 {
-	benchmark_t benchmark = {func, 0, 0, 0};
+	benchmark_t benchmark = {.wrapper_func = func};
 
 	return benchmark;
 }
 
+void benchmark_set_samples(benchmark_t *benchmark, uint32_t *buf, uint32_t size)
+{
+	benchmark->samples = buf;
+	benchmark->max_samples = size;
+	benchmark->num_samples = 0;
+}
+
+void benchmark_reset(benchmark_t *benchmark)
+{
+	benchmark->execuion_time = 0;
+	benchmark->idle_time = 0;
+	benchmark->num_runs = 0;
+	benchmark->cold_time = 0;
+	benchmark->num_samples = 0;
+}
+
 uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg)
 {
 	uint32_t now = utimer_get_us();
@@ -35,6 +52,12 @@ uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg)
 
 	uint32_t elapsed = utimer_get_us() - now;
 
+	if (benchmark->num_runs == 0) {
+		benchmark->cold_time = elapsed;
+	} else if (benchmark->num_samples < benchmark->max_samples) {
+		benchmark->samples[benchmark->num_samples++] = elapsed;
+	}
+
 	benchmark->execuion_time += elapsed;
 	benchmark->idle_time += zephyr_get_idle_time();
 	++benchmark->num_runs;
@@ -65,13 +88,74 @@ uint32_t benchmark_run_for(benchmark_t *benchmark, void *arg, uint32_t num_runs)
 	return BENCHMARK_OK;
 }
 
-benchmark_result_t benchmark_summarize(const benchmark_t *benchmark)
+static void sort_samples(uint32_t *samples, uint32_t num)
+{
+	for (uint32_t i = 1; i < num; ++i) {
+		uint32_t v = samples[i];
+		uint32_t j = i;
+
+		for (; j > 0 && samples[j - 1] > v; --j) {
+			samples[j] = samples[j - 1];
+		}
+		samples[j] = v;
+	}
+}
+
+/* Nearest-rank percentile of sorted samples */
+static uint32_t percentile(const uint32_t *sorted, uint32_t num, uint32_t pct)
+{
+	uint32_t rank = (pct * num + 99) / 100;
+
+	return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+benchmark_result_t benchmark_summarize(benchmark_t *benchmark)
 {
 	benchmark_result_t res = {0};
+	uint32_t num = benchmark->num_samples;
+
+	if (benchmark->num_runs == 0) {
+		return res;
+	}
 
-	res.avg_time = benchmark->execuion_time / benchmark->num_runs;
 	res.cpu_load =
 		(float)(benchmark->execuion_time - benchmark->idle_time) / benchmark->execuion_time;
+	res.cold_time = benchmark->cold_time;
+
+	if (num == 0) {
+		/* No per-run samples, report the totals only */
+		res.avg_time = benchmark->execuion_time / benchmark->num_runs;
+		res.min_time = res.avg_time;
+		res.median_time = res.avg_time;
+		res.p95_time = res.avg_time;
+		res.p99_time = res.avg_time;
+		return res;
+	}
+
+	uint32_t *s = benchmark->samples;
+	uint64_t sum = 0;
+
+	sort_samples(s, num);
+
+	for (uint32_t i = 0; i < num; ++i) {
+		sum += s[i];
+	}
+
+	float mean = (float)sum / num;
+	float var = 0.0f;
+
+	for (uint32_t i = 0; i < num; ++i) {
+		float d = s[i] - mean;
+
+		var += d * d;
+	}
+
+	res.avg_time = (uint32_t)(mean + 0.5f);
+	res.min_time = s[0];
+	res.median_time = s[num / 2];
+	res.p95_time = percentile(s, num, 95);
+	res.p99_time = percentile(s, num, 99);
+	res.stddev = num > 1 ? sqrtf(var / (num - 1)) : 0.0f;
 
 	return res;
 }
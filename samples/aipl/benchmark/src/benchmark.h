@@ -31,20 +31,39 @@ typedef struct {
 	uint32_t execuion_time;
 	uint32_t idle_time;
 	uint32_t num_runs;
+	/* Duration of the first run after a reset, caches and TLBs still cold */
+	uint32_t cold_time;
+	/* Per-run durations of the following (steady state) runs */
+	uint32_t *samples;
+	uint32_t max_samples;
+	uint32_t num_samples;
 } benchmark_t;
 
 typedef struct {
+	/* Steady state statistics in microseconds, the cold run excluded */
 	uint32_t avg_time;
 	float cpu_load;
+	uint32_t cold_time;
+	uint32_t min_time;
+	uint32_t median_time;
+	uint32_t p95_time;
+	uint32_t p99_time;
+	float stddev;
 } benchmark_result_t;
 
 benchmark_t benchmark_create(exec_wrap_func_t func);
 
+/* Record per-run durations of benchmark_run_once() into @p buf */
+void benchmark_set_samples(benchmark_t *benchmark, uint32_t *buf, uint32_t size);
+
+void benchmark_reset(benchmark_t *benchmark);
+
 uint32_t benchmark_run_once(benchmark_t *benchmark, void *arg);
 
 uint32_t benchmark_run_for(benchmark_t *benchmark, void *arg, uint32_t num_runs);
 
-benchmark_result_t benchmark_summarize(const benchmark_t *benchmark);
+/* Sorts the recorded samples in place */
+benchmark_result_t benchmark_summarize(benchmark_t *benchmark);
 
 #ifdef __cplusplus
 } /*extern "C"*/
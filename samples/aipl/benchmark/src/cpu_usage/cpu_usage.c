@@ -8,52 +8,32 @@
  *
  */
 
+/* Idle time from the load monitor subsystem, which owns the tracing hooks */
+
 #include "cpu_usage.h"
-#include <string.h>
-#include <stdbool.h>
 #include <zephyr/kernel.h>
-#include "utmr.h"
+#include "load_monitor/load_monitor.h"
 
-static bool cpu_usage_enabled;
-static volatile uint32_t idle_time_sum;
-static volatile uint32_t task_switch_timestamp;
-static volatile bool idle_task_running;
+static uint64_t idle_cycles_read;
 
-void sys_trace_thread_switched_in_user(void)
+void cpu_usage_enable(void)
 {
-	if (!cpu_usage_enabled) {
-		return;
-	}
-
-	if (strcmp(k_thread_name_get(k_current_get()), "idle") == 0) {
-		idle_task_running = true;
-	} else {
-		idle_task_running = false;
-	}
-	task_switch_timestamp = utimer_get_us();
+	load_monitor_reset();
+	idle_cycles_read = 0;
 }
 
-void sys_trace_thread_switched_out_user(void)
+uint32_t zephyr_get_idle_time(void)
 {
-	if (!cpu_usage_enabled) {
-		return;
-	}
+	uint64_t idle = load_monitor_idle_cycles();
 
-	if (idle_task_running) {
-		idle_time_sum += utimer_get_us() - task_switch_timestamp;
+	if (idle < idle_cycles_read) {
+		/* Statistics were reset behind our back */
+		idle_cycles_read = 0;
 	}
-}
 
-void cpu_usage_enable(void)
-{
-	cpu_usage_enabled = true;
-}
-
-uint32_t zephyr_get_idle_time(void)
-{
-	uint32_t tmp = idle_time_sum;
+	uint32_t us = k_cyc_to_us_floor64(idle - idle_cycles_read);
 
-	idle_time_sum = 0;
+	idle_cycles_read = idle;
 
-	return tmp;
+	return us;
 }
@@ -15,78 +15,135 @@
 
 #include "fps_counter.h"
 #include "utmr.h"
-#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * A bucket holds the number of its interval in the upper bits and the frame
+ * count in the lower ones. A bucket tagged with an older interval counts as
+ * empty, so the ring never has to be cleared when intervals pass without
+ * frames.
+ */
+#define COUNT_BITS 12
+#define COUNT_MASK ((1u << COUNT_BITS) - 1)
+#define TAG_MASK   (UINT32_MAX >> COUNT_BITS)
 
-fps_counter_t fps_counter_create(uint32_t interval_duration_us)
+static inline uint32_t bucket_pack(uint32_t interval, uint32_t count)
 {
-	fps_counter_t counter = {NULL, 0, interval_duration_us, utimer_get_us()};
-
-	return counter;
+	return ((interval & TAG_MASK) << COUNT_BITS) | count;
 }
 
-void fps_counter_destroy(fps_counter_t *counter)
+static inline uint32_t bucket_count(uint32_t bucket, uint32_t interval)
 {
-	fps_counter_interval_t *interval = counter->intervals;
+	return (bucket >> COUNT_BITS) == (interval & TAG_MASK) ? bucket & COUNT_MASK : 0;
+}
 
-	while (interval != NULL) {
-		fps_counter_interval_t *prev = interval->prev;
+static uint32_t current_interval(const fps_counter_t *counter, uint64_t now_ns)
+{
+	return (now_ns - counter->start_ns) / ((uint64_t)counter->interval_duration_us * 1000);
+}
 
-		free(interval);
+void fps_counter_init(fps_counter_t *counter, uint32_t interval_duration_us)
+{
+	memset(counter, 0, sizeof(*counter));
 
-		interval = prev;
-	}
+	counter->interval_duration_us = interval_duration_us;
+	counter->start_ns = utimer_get_ns();
 }
 
 void fps_counter_reset(fps_counter_t *counter, uint32_t interval_duration_us)
 {
-	fps_counter_destroy(counter);
-
-	counter->intervals = NULL;
-	counter->intervals_num = 0;
-	counter->interval_duration_us = interval_duration_us;
-	counter->start_timestamp_us = utimer_get_us();
+	fps_counter_init(counter, interval_duration_us);
 }
 
 void fps_counter_add_frame(fps_counter_t *counter)
 {
-	uint32_t timestamp = utimer_get_us();
-	uint32_t curr_interval =
-		(timestamp - counter->start_timestamp_us) / counter->interval_duration_us;
+	uint64_t now_ns = utimer_get_ns();
+	uint32_t now_us = now_ns / 1000;
+	uint32_t interval = current_interval(counter, now_ns);
+	atomic_t *bucket = &counter->buckets[interval % FPS_COUNTER_BUCKETS];
+	atomic_val_t old;
+	atomic_val_t new;
 
-	if (curr_interval < counter->intervals_num) {
-		++counter->intervals->frames;
-	} else {
-		while (curr_interval >= counter->intervals_num) {
-			fps_counter_interval_t *new_interval =
-				(fps_counter_interval_t *)malloc(sizeof(fps_counter_interval_t));
+	do {
+		old = atomic_get(bucket);
 
-			new_interval->frames = 0;
-			new_interval->prev = counter->intervals;
+		uint32_t count = bucket_count(old, interval);
 
-			counter->intervals = new_interval;
+		new = bucket_pack(interval, MIN(count + 1, COUNT_MASK));
+	} while (!atomic_cas(bucket, old, new));
 
-			++counter->intervals_num;
-		}
+	uint32_t prev_us = atomic_set(&counter->last_frame_us, now_us);
 
-		counter->intervals->frames = 1;
+	if (atomic_inc(&counter->frames) == 0) {
+		return;
 	}
+
+	uint32_t frame_time = now_us - prev_us;
+
+	atomic_set(&counter->frame_time_us, frame_time);
+	atomic_inc(&counter->frame_times[MIN(frame_time / FPS_COUNTER_BIN_US,
+					     FPS_COUNTER_BINS - 1)]);
 }
 
 float fps_counter_get_average(const fps_counter_t *counter)
 {
-	if (counter->intervals_num == 0) {
+	uint64_t elapsed_ns = utimer_get_ns() - counter->start_ns;
+
+	if (elapsed_ns == 0) {
 		return 0.0f;
 	}
 
-	uint32_t sum = 0;
+	return 1e9f * (uint32_t)atomic_get(&counter->frames) / elapsed_ns;
+}
 
-	fps_counter_interval_t *interval = counter->intervals;
+float fps_counter_get_instant(const fps_counter_t *counter)
+{
+	uint32_t frame_time = atomic_get(&counter->frame_time_us);
 
-	while (interval != NULL) {
-		sum += interval->frames;
+	return frame_time ? 1e6f / frame_time : 0.0f;
+}
 
-		interval = interval->prev;
+float fps_counter_get_windowed(const fps_counter_t *counter, uint32_t intervals)
+{
+	uint32_t now = current_interval(counter, utimer_get_ns());
+	uint32_t frames = 0;
+
+	intervals = MIN(intervals, MIN(now, FPS_COUNTER_BUCKETS - 1));
+	if (intervals == 0) {
+		return 0.0f;
+	}
+
+	for (uint32_t i = now - intervals; i < now; ++i) {
+		frames += bucket_count(atomic_get(&counter->buckets[i % FPS_COUNTER_BUCKETS]), i);
+	}
+
+	return 1e6f * frames / ((float)intervals * counter->interval_duration_us);
+}
+
+uint32_t fps_counter_get_frame_time_percentile(const fps_counter_t *counter, uint32_t pct)
+{
+	uint32_t total = 0;
+
+	for (int i = 0; i < FPS_COUNTER_BINS; ++i) {
+		total += atomic_get(&counter->frame_times[i]);
+	}
+
+	if (total == 0) {
+		return 0;
+	}
+
+	/* Nearest rank, reported as the upper edge of its bin */
+	uint32_t rank = MAX((pct * total + 99) / 100, 1u);
+
+	for (int i = 0; i < FPS_COUNTER_BINS; ++i) {
+		uint32_t n = atomic_get(&counter->frame_times[i]);
+
+		if (rank <= n) {
+			return (i + 1) * FPS_COUNTER_BIN_US;
+		}
+		rank -= n;
 	}
 
-	return 1000000.0f / counter->interval_duration_us * sum / counter->intervals_num;
+	return FPS_COUNTER_BINS * FPS_COUNTER_BIN_US;
 }
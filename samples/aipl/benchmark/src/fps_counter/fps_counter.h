@@ -11,6 +11,10 @@
 /**
  * @file fps_counter.h
  *
+ * Frame rate counter on fixed-size storage. Frames are counted into a ring
+ * of interval buckets and their spacing into a frame time histogram, both
+ * updated with atomic operations only, so fps_counter_add_frame() may be
+ * called from an ISR and runs indefinitely without allocating.
  */
 
 #ifndef FPS_COUNTER_H
@@ -21,30 +25,46 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <zephyr/sys/atomic.h>
 
-typedef struct fps_counter_interval fps_counter_interval_t;
-struct fps_counter_interval {
-	uint32_t frames;
-	fps_counter_interval_t *prev;
-};
+/* Intervals kept for the windowed rate, the newest one still filling */
+#define FPS_COUNTER_BUCKETS 64
+
+/* Frame time histogram: bins of FPS_COUNTER_BIN_US, the last one open-ended */
+#define FPS_COUNTER_BINS   128
+#define FPS_COUNTER_BIN_US 500
 
 typedef struct {
-	fps_counter_interval_t *intervals;
-	uint32_t intervals_num;
+	uint64_t start_ns;
 	uint32_t interval_duration_us;
-	uint32_t start_timestamp_us;
+	atomic_t frames;
+	/* Microsecond timestamp of the last frame and its distance to the one before */
+	atomic_t last_frame_us;
+	atomic_t frame_time_us;
+	/* Interval number tag and frame count, see fps_counter.c */
+	atomic_t buckets[FPS_COUNTER_BUCKETS];
+	atomic_t frame_times[FPS_COUNTER_BINS];
 } fps_counter_t;
 
-fps_counter_t fps_counter_create(uint32_t interval_duration_us);
-
-void fps_counter_destroy(fps_counter_t *counter);
+void fps_counter_init(fps_counter_t *counter, uint32_t interval_duration_us);
 
+/* Not ISR safe; no frames may be added concurrently */
 void fps_counter_reset(fps_counter_t *counter, uint32_t interval_duration_us);
 
 void fps_counter_add_frame(fps_counter_t *counter);
 
+/* Frame rate over the whole run */
 float fps_counter_get_average(const fps_counter_t *counter);
 
+/* Frame rate from the distance of the last two frames */
+float fps_counter_get_instant(const fps_counter_t *counter);
+
+/* Frame rate over the last @p intervals completed intervals, up to FPS_COUNTER_BUCKETS - 1 */
+float fps_counter_get_windowed(const fps_counter_t *counter, uint32_t intervals);
+
+/* Frame time in microseconds below which @p pct percent of the frames fall */
+uint32_t fps_counter_get_frame_time_percentile(const fps_counter_t *counter, uint32_t pct);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -47,8 +47,8 @@ void graph_draw_frame(const graph_frame_t *frame)
 {
 	d2_device *handle = aipl_dave2d_handle();
 
-	d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_height(),
-		       display_height(), d2_mode_rgb565);
+	d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_width(),
+		       display_height(), display_d2_mode());
 
 	if (frame->clut != NULL) {
 		/* dave2d_set_clut((d2_color*)frame->clut, frame->clut_format); */
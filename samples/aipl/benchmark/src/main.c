@@ -8,13 +8,19 @@
  *
  */
 
+#ifndef CONFIG_BENCHMARK_HEADLESS
 #include "dbuf_display/display.h"
 #include "dave_d0lib.h"
 #include "aipl_dave2d.h"
+#include "objects.h"
+#endif
 
 #include "perf_tests.h"
-#include "objects.h"
 #include "img_assets/assets.h"
+#include "img_assets/img_asset_data.h"
+#ifdef CONFIG_VIDEO_POOL
+#include "video_pool/video_pool.h"
+#endif
 
 #include "utmr.h"
 #include "fps_counter.h"
@@ -24,6 +30,7 @@
 #include "aipl_color_correction.h"
 #include "aipl_white_balance.h"
 #include "aipl_lut_transform.h"
+#include "aipl_resize.h"
 
 #include <math.h>
 
@@ -32,12 +39,11 @@
 #define D1_HEAP_SIZE 0x180000
 
 #define FRAME_TIME_MS    20
-#define NUM_MEASUREMENTS 100
+#define NUM_MEASUREMENTS CONFIG_BENCHMARK_ITERATIONS
 #define FPS_CNT_INT_MS   100
 #define COLOR_FORMATS    (AIPL_COLOR_UYVY + 1)
-#define NUM_OPERATIONS   (COLOR_FORMATS + 7)
-#define TABLE_COL_WIDTH  20
 
+#ifndef CONFIG_BENCHMARK_HEADLESS
 #ifdef CONFIG_D0_HEAP_SECTION
 #define D0_HEAP_ATTRS __attribute__((section(CONFIG_D0_HEAP_SECTION)))
 #else
@@ -45,20 +51,29 @@
 #endif
 
 static uint8_t D0_HEAP_ATTRS d0_heap[D1_HEAP_SIZE];
+#endif
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(app, CONFIG_LOG_DEFAULT_LEVEL);
 
-static char *bench_names[NUM_OPERATIONS] = {
-	"to ALPHA8",     "to ARGB8888",      "to ARGB4444", "to ARGB1555", "to RGBA8888",
-	"to RGBA4444",   "to RGBA5551",      "to BGR888",   "to RGB888",   "to RGB565",
-	"to YV12",       "to I420",          "to I422",     "to I444",     "to I400",
-	"to NV21",       "to NV12",          "to YUY2",     "to UYVY",     "Color correction",
-	"White balance", "Gamma correction", "Flipping",    "Cropping",    "Resize",
-	"Rotation",
+/*
+ * Source sizes of the sweep; the sample photo is scaled to each of them. The
+ * halves of every size stay even so the YUV formats remain valid for the
+ * cropping and resize destinations.
+ */
+static const struct {
+	uint16_t width;
+	uint16_t height;
+} bench_sizes[] = {
+	{480, 360}, /* Full sample photo */
+	{320, 240},
+	{192, 192},
+	{200, 120}, /* Width not a multiple of 16, exercises the vector tails */
 };
-static benchmark_result_t bench_results[COLOR_FORMATS][NUM_OPERATIONS];
+
+static uint32_t bench_samples[NUM_MEASUREMENTS];
+static fps_counter_t fps_counter;
 
 static void prepare_color_conversion(aipl_image_t *src, aipl_image_t *dst, op_arg_t *args)
 {
@@ -114,8 +129,9 @@ static void prepare_gamma_correction(aipl_image_t *src, aipl_image_t *dst, gc_op
 
 static void prepare_cropping(aipl_image_t *src, aipl_image_t *dst, crop_op_arg_t *args)
 {
-	args->left = 200;
-	args->top = 100;
+	/* Centered, even offsets keep the crop valid for every size and format */
+	args->left = ((src->width - dst->width) / 2) & ~1u;
+	args->top = ((src->height - dst->height) / 2) & ~1u;
 
 	args->src = src;
 	args->dst = dst;
@@ -145,26 +161,85 @@ static void prepare_rotation(aipl_image_t *src, aipl_image_t *dst, rot_op_arg_t
 	args->rotation = AIPL_ROTATE_90;
 }
 
+/*
+ * On native_sim the runs are timed with the host clock while idle time is
+ * simulated, so the CPU load would be meaningless. Frames are only counted
+ * when they are drawn.
+ */
+#define REPORT_CPU_LOAD (!IS_ENABLED(CONFIG_ARCH_POSIX))
+#define REPORT_FPS      IS_ENABLED(CONFIG_BENCHMARK_DRAW)
+
+static void report(const aipl_image_t *src, const aipl_image_t *dst, const char *name,
+		   const benchmark_result_t *res, float fps)
+{
+	/* Left out of JSON and empty in CSV when not measured */
+	char load_str[16] = "";
+	char fps_str[16] = "";
+
+	if (REPORT_CPU_LOAD) {
+		snprintk(load_str, sizeof(load_str), "%.1f", (double)res->cpu_load * 100);
+	}
+	if (REPORT_FPS) {
+		snprintk(fps_str, sizeof(fps_str), "%.1f", (double)fps);
+	}
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	char extra[48] = "";
+	int len = 0;
+
+	if (REPORT_CPU_LOAD) {
+		len += snprintk(extra + len, sizeof(extra) - len, ",\"cpu_load\":%s", load_str);
+	}
+	if (REPORT_FPS) {
+		snprintk(extra + len, sizeof(extra) - len, ",\"fps\":%s", fps_str);
+	}
+
+	printk("{\"op\":\"%s\",\"src\":\"%s\",\"dst\":\"%s\",\"width\":%u,\"height\":%u,"
+	       "\"iterations\":%u,\"avg_us\":%u,\"cold_us\":%u,\"min_us\":%u,\"median_us\":%u,"
+	       "\"p95_us\":%u,\"p99_us\":%u,\"stddev_us\":%.1f%s}\n",
+	       name, aipl_color_format_str(src->format), aipl_color_format_str(dst->format),
+	       src->width, src->height, NUM_MEASUREMENTS, res->avg_time, res->cold_time,
+	       res->min_time, res->median_time, res->p95_time, res->p99_time, (double)res->stddev,
+	       extra);
+#else
+	printk("%s,%s,%ux%u,%s,%u,%s,%s,%u,%u,%u,%u,%u,%.1f\r\n",
+	       aipl_color_format_str(src->format), aipl_color_format_str(dst->format), src->width,
+	       src->height, name, res->avg_time, load_str, fps_str, res->cold_time,
+	       res->min_time, res->median_time, res->p95_time, res->p99_time,
+	       (double)res->stddev);
+#endif
+}
+
 static benchmark_result_t perform_benchmark(const aipl_image_t *input, aipl_image_t *output,
 					    benchmark_t *bench, void *args, const char *name)
 {
 	utimer_start();
 
-	fps_counter_t fps_counter = fps_counter_create(FPS_CNT_INT_MS * 1000);
+	fps_counter_reset(&fps_counter, FPS_CNT_INT_MS * 1000);
+
+	benchmark_reset(bench);
+	benchmark_set_samples(bench, bench_samples, NUM_MEASUREMENTS);
 
 	for (uint32_t i = 0; i < NUM_MEASUREMENTS; ++i) {
+#ifdef CONFIG_BENCHMARK_DRAW
 		d2_device *handle = aipl_dave2d_handle();
 
 		d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_width(),
-			       display_height(), d2_mode_rgb565);
+			       display_height(), display_d2_mode());
 
 		graph_clear_screen();
+#endif
 
 		if (benchmark_run_once(bench, args) != AIPL_ERR_OK) {
 			benchmark_result_t res = {0, 0.0f};
+
+			LOG_ERR("%s %s to %s %ux%u failed", name, aipl_color_format_str(input->format),
+				aipl_color_format_str(output->format), input->width, input->height);
+			utimer_stop();
 			return res;
 		}
 
+#ifdef CONFIG_BENCHMARK_DRAW
 		graph_object_t img_obj1 =
 			graph_create_image(0, 40, input->data, input->pitch, input->width,
 					   input->height, input->format);
@@ -182,31 +257,164 @@ static benchmark_result_t perform_benchmark(const aipl_image_t *input, aipl_imag
 
 		graph_destroy_object(&img_obj1);
 		graph_destroy_object(&img_obj2);
+#endif
 	}
 
 	benchmark_result_t res = benchmark_summarize(bench);
 
-	bench->execuion_time = 0;
-	bench->idle_time = 0;
-	bench->num_runs = 0;
-
-	/* Color format, Test name, CPU load[%%], Avg. time[us], Avg. FPS, DAVE2D */
-	printk("%s,%s,%u,%.1f,%.1f\r\n", aipl_color_format_str(input->format), name, res.avg_time,
-	       (double)res.cpu_load * 100, (double)fps_counter_get_average(&fps_counter));
+	report(input, output, name, &res, fps_counter_get_average(&fps_counter));
 
 	utimer_stop();
 
 	return res;
 }
 
+/* All operations on @p image converted to @p format */
+static void benchmark_format(const aipl_image_t *image, aipl_color_format_t format)
+{
+	aipl_image_t src;
+	aipl_image_t dst;
+
+	if (image->format == format) {
+		src = *image;
+	} else {
+		if (aipl_image_create(&src, image->width, image->width, image->height, format) !=
+		    AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for source image");
+			return;
+		}
+
+		if (aipl_color_convert_img(image, &src) != AIPL_ERR_OK) {
+			LOG_ERR("Failed to convert source image");
+			aipl_image_destroy(&src);
+			return;
+		}
+	}
+
+	/* Color conversions */
+	benchmark_t cnv_bench = create_color_conversion_benchmark();
+
+	for (int j = AIPL_COLOR_ALPHA8; j < COLOR_FORMATS; ++j) {
+		if (src.format == j) {
+			continue;
+		}
+
+		if (aipl_image_create(&dst, src.width, src.width, src.height, j) != AIPL_ERR_OK) {
+			LOG_ERR("Not enough memory for color conversion destination image");
+			continue;
+		}
+
+		op_arg_t cnv_args;
+
+		prepare_color_conversion(&src, &dst, &cnv_args);
+		perform_benchmark(&src, &dst, &cnv_bench, &cnv_args, "Color conversion");
+
+		aipl_image_destroy(&dst);
+	}
+
+	/* Destination of equal size and format */
+	if (aipl_image_create(&dst, src.width, src.width, src.height, src.format) == AIPL_ERR_OK) {
+		benchmark_t cc_bench = create_color_correction_benchmark();
+		cc_op_arg_t cc_args;
+
+		prepare_color_correction(&src, &dst, &cc_args);
+		perform_benchmark(&src, &dst, &cc_bench, &cc_args, "Color correction");
+
+		benchmark_t wb_bench = create_white_balance_benchmark();
+		wb_op_arg_t wb_args;
+
+		prepare_white_balance(&src, &dst, &wb_args);
+		perform_benchmark(&src, &dst, &wb_bench, &wb_args, "White balance");
+
+		benchmark_t gc_bench = create_lut_transform_benchmark();
+		gc_op_arg_t gc_args;
+
+		prepare_gamma_correction(&src, &dst, &gc_args);
+		perform_benchmark(&src, &dst, &gc_bench, &gc_args, "Gamma correction");
+
+		benchmark_t flip_bench = create_flipping_benchmark();
+		flip_op_arg_t flip_args;
+
+		prepare_flipping(&src, &dst, &flip_args);
+		perform_benchmark(&src, &dst, &flip_bench, &flip_args, "Flipping");
+
+		aipl_image_destroy(&dst);
+	} else {
+		LOG_ERR("Not enough memory for destination image with the same size as source");
+	}
+
+	/* Destination is half width and height */
+	if (aipl_image_create(&dst, src.width / 2, src.width / 2, src.height / 2, src.format) ==
+	    AIPL_ERR_OK) {
+		benchmark_t crop_bench = create_cropping_benchmark();
+		crop_op_arg_t crop_args;
+
+		prepare_cropping(&src, &dst, &crop_args);
+		perform_benchmark(&src, &dst, &crop_bench, &crop_args, "Cropping");
+
+		benchmark_t resize_bench = create_resize_benchmark();
+		op_arg_t resize_args;
+
+		prepare_resize(&src, &dst, &resize_args);
+		perform_benchmark(&src, &dst, &resize_bench, &resize_args, "Resize");
+
+		aipl_image_destroy(&dst);
+	} else {
+		LOG_ERR("Not enough memory for destination image with the half source size");
+	}
+
+	/* Rotation */
+	if (aipl_image_create(&dst, src.height, src.height, src.width, src.format) ==
+	    AIPL_ERR_OK) {
+		benchmark_t rot_bench = create_rotation_benchmark();
+		rot_op_arg_t rot_args;
+
+		prepare_rotation(&src, &dst, &rot_args);
+		perform_benchmark(&src, &dst, &rot_bench, &rot_args, "Rotation");
+
+		aipl_image_destroy(&dst);
+	} else {
+		LOG_ERR("Not enough memory for rotation destination image");
+	}
+
+	if (src.data != image->data) {
+		aipl_image_destroy(&src);
+	}
+}
+
+/* Expand the compressed sample photo, the source of every run, into RAM */
+static int load_sample_photo(aipl_image_t *image)
+{
+	const struct img_asset *photo = &IMG_ASSET_SAMPLE_PHOTO;
+	int ret;
+
+	if (aipl_image_create(image, photo->width, photo->width, photo->height,
+			      AIPL_COLOR_ARGB8888) != AIPL_ERR_OK) {
+		return -ENOMEM;
+	}
+
+	ret = img_asset_decode(photo, COLOR_ARGB8888, image->data, image->pitch);
+	if (ret) {
+		aipl_image_destroy(image);
+	}
+
+	return ret;
+}
+
 int main(void)
 {
+#ifndef CONFIG_BENCHMARK_HEADLESS
 	/* Initialize display */
 	if (display_init()) {
 		LOG_ERR("Display initializing error");
 		return -1;
 	}
 
+	if (display_d2_mode() < 0) {
+		LOG_ERR("D/AVE2D cannot render to the display format");
+		return -1;
+	}
+
 #ifdef CONFIG_D1_MALLOC_D0LIB
 	/* Initialize D/AVE D0 heap */
 	if (!d0_initheapmanager(d0_heap, sizeof(d0_heap), d0_mm_fixed_range, NULL, 0, 0, 0,
@@ -221,14 +429,17 @@ int main(void)
 		LOG_ERR("D/AVE2D initialization failed\n");
 		return -1;
 	}
+#endif
 
 	/* Initialize utimer */
 	utimer_init();
 
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
+	aipl_image_t image;
 
-	aipl_image_t image = {test_img->data, test_img->pitch, test_img->width, test_img->height,
-			      test_img->format};
+	if (load_sample_photo(&image)) {
+		LOG_ERR("Failed to decode the sample photo");
+		return -1;
+	}
 
 	utimer_start();
 
@@ -236,6 +447,10 @@ int main(void)
 
 	LOG_INF("AIPL BENCHMARK");
 
+#ifdef CONFIG_BENCHMARK_HEADLESS
+	LOG_INF("HEADLESS, DISPLAY AND D/AVE2D DISABLED");
+#endif
+
 #ifdef CONFIG_AIPL_DAVE2D_ACCELERATION
 	LOG_INF("AIPL DAVE2D ACCELERATION ENABLED");
 #else
@@ -247,154 +462,48 @@ int main(void)
 	LOG_INF("AIPL HELIUM ACCELERATION DISABLED");
 #endif
 
-	printk("Color format,Test name,Avg. time[us],CPU load[%%],Avg. FPS\n");
+#ifndef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("Source format,Destination format,Size,Test name,Avg. time[us],CPU load[%%],"
+	       "Avg. FPS,Cold time[us],Min. time[us],Median time[us],P95 time[us],P99 time[us],"
+	       "Std. dev.[us]\n");
+#endif
 
-	for (int i = AIPL_COLOR_ALPHA8; i < COLOR_FORMATS; ++i) {
-		aipl_image_t src;
+	for (size_t k = 0; k < ARRAY_SIZE(bench_sizes); ++k) {
+		aipl_image_t scaled = image;
 
-		if (image.format == i) {
-			src = image;
-		} else {
-			if (aipl_image_create(&src, image.width, image.width, image.height, i) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for source image");
+		if (bench_sizes[k].width != image.width || bench_sizes[k].height != image.height) {
+			if (aipl_image_create(&scaled, bench_sizes[k].width, bench_sizes[k].width,
+					      bench_sizes[k].height, image.format) != AIPL_ERR_OK) {
+				LOG_ERR("Not enough memory for scaled source image");
 				continue;
 			}
 
-			if (aipl_color_convert_img(&image, &src) != AIPL_ERR_OK) {
-				LOG_ERR("Failed to convert source image");
-				aipl_image_destroy(&src);
+			if (aipl_resize_img(&image, &scaled, true) != AIPL_ERR_OK) {
+				LOG_ERR("Failed to scale source image");
+				aipl_image_destroy(&scaled);
 				continue;
 			}
 		}
 
-		/* Color conversions  */
-		benchmark_t cnv_bench = create_color_conversion_benchmark();
-
-		int j = AIPL_COLOR_ALPHA8;
-
-		for (; j < COLOR_FORMATS; ++j) {
-			if (i == j) {
-				continue;
-			}
-
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.width, src.width, src.height, j) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for color conversion destination image");
-				continue;
-			}
-
-			op_arg_t cnv_args;
-
-			prepare_color_conversion(&src, &dst, &cnv_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &cnv_bench, &cnv_args,
-								bench_names[j]);
-
-			aipl_image_destroy(&dst);
+		for (int i = AIPL_COLOR_ALPHA8; i < COLOR_FORMATS; ++i) {
+			benchmark_format(&scaled, i);
 		}
 
-		/* Destination of equal size and format */
-		{
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.width, src.width, src.height, src.format) !=
-			    AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for destination image with the same "
-					"size as source");
-				continue;
-			}
-			benchmark_t cc_bench = create_color_correction_benchmark();
-			cc_op_arg_t cc_args;
-
-			prepare_color_correction(&src, &dst, &cc_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &cc_bench, &cc_args, bench_names[j]);
-			++j;
-
-			benchmark_t wb_bench = create_white_balance_benchmark();
-			wb_op_arg_t wb_args;
-
-			prepare_white_balance(&src, &dst, &wb_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &wb_bench, &wb_args, bench_names[j]);
-			++j;
-
-			benchmark_t gc_bench = create_lut_transform_benchmark();
-			gc_op_arg_t gc_args;
-
-			prepare_gamma_correction(&src, &dst, &gc_args);
-			bench_results[i][j] =
-				perform_benchmark(&src, &dst, &gc_bench, &gc_args, bench_names[j]);
-			++j;
-
-			benchmark_t flip_bench = create_flipping_benchmark();
-			flip_op_arg_t flip_args;
-
-			prepare_flipping(&src, &dst, &flip_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &flip_bench, &flip_args,
-								bench_names[j]);
-			++j;
-
-			aipl_image_destroy(&dst);
+		if (scaled.data != image.data) {
+			aipl_image_destroy(&scaled);
 		}
+	}
 
-		/* Destination is half width and height */
-		{
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.width / 2, src.width / 2, src.height / 2,
-					      src.format) != AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for destination image with the half "
-					"source size");
-				continue;
-			}
-
-			benchmark_t crop_bench = create_cropping_benchmark();
-			crop_op_arg_t crop_args;
-
-			prepare_cropping(&src, &dst, &crop_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &crop_bench, &crop_args,
-								bench_names[j]);
-			++j;
-
-			benchmark_t resize_bench = create_resize_benchmark();
-			op_arg_t resize_args;
-
-			prepare_resize(&src, &dst, &resize_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &resize_bench,
-								&resize_args, bench_names[j]);
-			++j;
-
-			aipl_image_destroy(&dst);
-		}
-
-		/* Rotation */
-		{
-			aipl_image_t dst;
-
-			if (aipl_image_create(&dst, src.height, src.height, src.width,
-					      src.format) != AIPL_ERR_OK) {
-				LOG_ERR("Not enough memory for rotation destination image");
-				continue;
-			}
-
-			benchmark_t rot_bench = create_rotation_benchmark();
-			rot_op_arg_t rot_args;
-
-			prepare_rotation(&src, &dst, &rot_args);
-			bench_results[i][j] = perform_benchmark(&src, &dst, &rot_bench, &rot_args,
-								bench_names[j]);
-			++j;
+	aipl_image_destroy(&image);
 
-			aipl_image_destroy(&dst);
-		}
+#ifdef CONFIG_VIDEO_POOL
+	struct video_pool_stats pool_stats;
 
-		if (image.format != i) {
-			aipl_image_destroy(&src);
-		}
-	}
+	video_pool_get_stats(&pool_stats);
+	LOG_INF("Video pool: %u allocations, %u reused, %u failed, peak %u bytes held",
+		pool_stats.allocs, pool_stats.hits, pool_stats.failures,
+		(uint32_t)pool_stats.peak_held_bytes);
+#endif
 
 	LOG_INF("Benchmark complete");
 
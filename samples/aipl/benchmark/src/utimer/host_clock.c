@@ -0,0 +1,28 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file host_clock.c
+ *
+ * Built into the native_sim runner, not the embedded image, so it can read
+ * the host monotonic clock rather than the simulated time.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t benchmark_host_clock_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
@@ -0,0 +1,55 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file utmr_host.c
+ *
+ * utimer API on native_sim, backed by the host monotonic clock.
+ */
+
+#include "utmr.h"
+
+/* Provided by host_clock.c in the native_sim runner */
+uint64_t benchmark_host_clock_ns(void);
+
+static uint64_t start_ns;
+
+void utimer_init(void)
+{
+}
+
+void utimer_start(void)
+{
+	start_ns = benchmark_host_clock_ns();
+}
+
+void utimer_stop(void)
+{
+}
+
+uint32_t utimer_get_s(void)
+{
+	return utimer_get_ns() / 1000000000u;
+}
+
+uint32_t utimer_get_ms(void)
+{
+	return utimer_get_ns() / 1000000u;
+}
+
+uint32_t utimer_get_us(void)
+{
+	return utimer_get_ns() / 1000u;
+}
+
+uint64_t utimer_get_ns(void)
+{
+	return benchmark_host_clock_ns() - start_ns;
+}
@@ -14,6 +14,21 @@
  */
 
 #include <aipl_video_alloc.h>
+
+#ifdef CONFIG_VIDEO_POOL
+#include "video_pool/video_pool.h"
+
+/* Recycle same-size images instead of returning them to the D0 heap */
+void *aipl_video_alloc(uint32_t size)
+{
+	return video_pool_alloc(size);
+}
+
+void aipl_video_free(void *ptr)
+{
+	video_pool_free(ptr);
+}
+#else
 #include <dave_d0lib.h>
 #include <stdint.h>
 
@@ -50,3 +65,4 @@ void aipl_video_free(void *ptr)
 		d0_freevidmem(raw);
 	}
 }
+#endif
@@ -45,7 +45,7 @@ void aipl_dave2d_prepare(void)
 
 	/* Prepare frame buffer */
 	d2_framebuffer(handle, display_inactive_buffer(), display_width(), display_width(),
-		       display_height(), d2_mode_rgb565);
+		       display_height(), display_d2_mode());
 	/* Set background */
 	d2_clear(handle, 0x00f0f0f0);
 }
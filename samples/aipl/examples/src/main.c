@@ -24,7 +24,9 @@
 
 #include "image.h"
 #include "img_assets/assets.h"
+#include "img_assets/img_asset_data.h"
 #include "dbuf_display/display.h"
+#include "aipl_strip/aipl_strip.h"
 
 #include <soc_common.h>
 #include <se_service.h>
@@ -44,12 +46,31 @@ LOG_MODULE_REGISTER(app, CONFIG_LOG_DEFAULT_LEVEL);
 
 static uint8_t D0_HEAP_ATTRS d0_heap[D1_HEAP_SIZE];
 
+/* Sample photo decoded from the compressed asset store, source of every example */
+static aipl_image_t sample_photo;
+
+static int load_sample_photo(void)
+{
+	const struct img_asset *photo = &IMG_ASSET_SAMPLE_PHOTO;
+	int ret;
+
+	if (aipl_image_create(&sample_photo, photo->width, photo->width, photo->height,
+			      AIPL_COLOR_ARGB8888) != AIPL_ERR_OK) {
+		return -ENOMEM;
+	}
+
+	ret = img_asset_decode(photo, COLOR_ARGB8888, sample_photo.data, sample_photo.pitch);
+	if (ret) {
+		aipl_image_destroy(&sample_photo);
+	}
+
+	return ret;
+}
+
 static void crop_scale_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination image for cropping */
 	uint32_t p = src_image.pitch / 4;
@@ -92,9 +113,7 @@ static void crop_scale_example(void)
 static void crop_flip_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination image for cropping */
 	uint32_t p = src_image.pitch / 2;
@@ -137,9 +156,7 @@ static void crop_flip_example(void)
 static void scale_rotate_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination image for scaling */
 	uint32_t p = src_image.pitch / 2;
@@ -186,9 +203,7 @@ static void scale_rotate_example(void)
 static void color_conversion_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination buffer for converted image */
 	aipl_image_t dst_image;
@@ -217,9 +232,7 @@ static void color_conversion_example(void)
 static void color_correction_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -251,9 +264,7 @@ static void color_correction_example(void)
 static void white_balance_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination white balanced image */
 	aipl_image_t dst_image;
@@ -282,9 +293,7 @@ static void white_balance_example(void)
 static void gamma_correction_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -330,9 +339,7 @@ static void gamma_correction_example(void)
 static void exposure_adjustment_example(void)
 {
 	/* Prepare the source image */
-	const image_t *test_img = &SAMPLE_PHOTO_ARGB8888;
-	const aipl_image_t src_image = {test_img->data, test_img->pitch, test_img->width,
-					test_img->height, test_img->format};
+	const aipl_image_t src_image = sample_photo;
 
 	/* Prepare the destination color corrected image */
 	aipl_image_t dst_image;
@@ -365,6 +372,60 @@ static void exposure_adjustment_example(void)
 	aipl_image_destroy(&dst_image);
 }
 
+/* Example of chaining crop, scale and conversion over strips of 8 rows */
+static void strip_pipeline_example(void)
+{
+	/* Prepare the source image */
+	const aipl_image_t src_image = sample_photo;
+
+	/* Crop the centre, scale it to 224x224 and convert to RGB565 */
+	const struct aipl_strip_op ops[] = {
+		AIPL_STRIP_OP_CROP(60, 0, 360, 360),
+		AIPL_STRIP_OP_RESIZE(224, 224, true),
+		AIPL_STRIP_OP_CONVERT(AIPL_COLOR_RGB565),
+	};
+	struct aipl_strip_pipeline pipeline;
+
+	if (aipl_strip_init(&pipeline, src_image.width, src_image.height, src_image.format, ops,
+			    ARRAY_SIZE(ops), 8)) {
+		LOG_ERR("Strip pipeline initialization failed");
+		return;
+	}
+
+	/* Only the final image is allocated in full */
+	aipl_image_t dst_image;
+
+	if (aipl_strip_create_output(&pipeline, &dst_image)) {
+		aipl_strip_release(&pipeline);
+		return;
+	}
+
+	if (aipl_strip_run(&pipeline, &src_image, &dst_image)) {
+		LOG_ERR("Strip pipeline failed");
+		aipl_strip_release(&pipeline);
+		aipl_image_destroy(&dst_image);
+		return;
+	}
+
+	/* Separate crop and resize calls would need both intermediates in full */
+	LOG_INF("Strip buffers: %u bytes instead of %u bytes", (uint32_t)pipeline.buf_size,
+		(360 * 360 + 224 * 224) * 4);
+
+	/* Prepare DAVE2D for image rendering */
+	aipl_dave2d_prepare();
+
+	/* Draw source and destination images */
+	aipl_image_draw(0, 20, &src_image);
+	aipl_image_draw(0, 400, &dst_image);
+
+	/* Execute HW rendering */
+	aipl_dave2d_render();
+
+	/* Release the strip buffers and the destination image */
+	aipl_strip_release(&pipeline);
+	aipl_image_destroy(&dst_image);
+}
+
 int main(void)
 {
 	/* Initialize display */
@@ -373,6 +434,11 @@ int main(void)
 		return -1;
 	}
 
+	if (display_d2_mode() < 0) {
+		LOG_ERR("D/AVE2D cannot render to the display format");
+		return -1;
+	}
+
 #ifdef CONFIG_D1_MALLOC_D0LIB
 	/* Initialize D/AVE D0 heap */
 	if (!d0_initheapmanager(d0_heap, sizeof(d0_heap), d0_mm_fixed_range, NULL, 0, 0, 0,
@@ -388,6 +454,11 @@ int main(void)
 		return -1;
 	}
 
+	if (load_sample_photo()) {
+		LOG_ERR("Failed to decode the sample photo");
+		return -1;
+	}
+
 	/* Run AIPL examples */
 	while (true) {
 		LOG_INF("Example 1: Crop the image and scale it up");
@@ -413,6 +484,9 @@ int main(void)
 		k_msleep(3000);
 		LOG_INF("Example 8: Exposure adjustment");
 		exposure_adjustment_example();
+		k_msleep(3000);
+		LOG_INF("Example 9: Crop, scale down and convert to RGB565 in strips");
+		strip_pipeline_example();
 		k_msleep(5000);
 	}
 
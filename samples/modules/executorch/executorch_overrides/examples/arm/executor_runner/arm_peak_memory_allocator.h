@@ -0,0 +1,59 @@
+/* Copyright 2026 Alif Semiconductor
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Alif addition, copied next to arm_memory_allocator.h by
+ * apply_executorch_overrides.py and shared by the Zephyr executor runner and
+ * the executorch samples.
+ */
+
+#pragma once
+
+#include <executorch/examples/arm/executor_runner/arm_memory_allocator.h>
+#include <zephyr/sys/printk.h>
+
+#include <stddef.h>
+
+// Tracks the peak usage of an ArmMemoryAllocator across reset() calls. The temp
+// allocator is reset after every kernel/delegate call, so used_size() alone
+// only shows the last one. A failed request still raises the peak to the size
+// that would have been needed, so an undersized pool reports its requirement.
+class PeakArmMemoryAllocator : public ArmMemoryAllocator {
+ public:
+  using ArmMemoryAllocator::ArmMemoryAllocator;
+
+  void* allocate(size_t size, size_t alignment = kDefaultAlignment) override {
+    size_t before = used_size();
+    void* ret = ArmMemoryAllocator::allocate(size, alignment);
+    size_t needed = ret != nullptr ? used_size() : before + size;
+    if (needed > peak_size_) {
+      peak_size_ = needed;
+    }
+    return ret;
+  }
+
+  size_t peak_size() const {
+    return peak_size_;
+  }
+
+ private:
+  size_t peak_size_ = 0;
+};
+
+// One line per pool in the format parsed by scripts/gen_arena_sizes.py, "macro"
+// is the define that sizes the pool.
+inline void report_arena_hwm(
+    const char* model,
+    const char* pool,
+    const char* macro,
+    size_t used,
+    size_t size) {
+  printk(
+      "arena_hwm: model=%s pool=%s macro=%s used=%zu size=%zu\n",
+      model,
+      pool,
+      macro,
+      used,
+      size);
+}
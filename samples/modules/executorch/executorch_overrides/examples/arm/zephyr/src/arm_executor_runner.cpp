@@ -10,12 +10,15 @@
  * Alif Semiconductor Zephyr SDK. Changes include:
  * - Memory sections changed to .alif_sram0.tensor_arena and .alif_sram0.ethosu_scratch
  * - Updated CONFIG_ETHOS_U to CONFIG_ARM_ETHOS_U
- * - Added MODEL_IN_RAM conditional compilation guards
+ * - Added an optional on-demand segment cache (CONFIG_EXECUTORCH_MODEL_CACHE)
+ *   as the replacement for the deprecated MODEL_IN_RAM boot-time copy
  * - Changed main() signature to main(void) for Zephyr compatibility
+ * - Added peak usage reporting of the method and temp allocators
  */
 
 #include <errno.h>
 #include <executorch/examples/arm/executor_runner/arm_memory_allocator.h>
+#include <executorch/examples/arm/executor_runner/arm_peak_memory_allocator.h>
 #include <executorch/extension/data_loader/buffer_data_loader.h>
 #include <executorch/extension/runner_util/inputs.h>
 #include <executorch/runtime/core/memory_allocator.h>
@@ -32,6 +35,11 @@
 #include <memory>
 #include <vector>
 
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+#include <zephyr/storage/flash_map.h>
+#include "cached_data_loader.h"
+#endif
+
 /**
  * This header file is generated by the build process based on the .pte file
  * specified in the ET_PTE_FILE_PATH variable to the cmake build.
@@ -43,12 +51,15 @@
  */
 #include "model_pte.h"
 
-// Runtime copy of the model blob placed in ISRAM so that the Ethos-U DMA can
-// access command stream and weights. The original model_pte[] lives in flash.
 #if defined(MODEL_IN_RAM)
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+#warning "MODEL_IN_RAM is ignored with CONFIG_EXECUTORCH_MODEL_CACHE"
+#else
+#warning "MODEL_IN_RAM is deprecated, use CONFIG_EXECUTORCH_MODEL_CACHE"
 alignas(16) static unsigned char model_pte_runtime[sizeof(model_pte)];
 static bool model_pte_runtime_initialized = false;
 #endif
+#endif
 
 using executorch::aten::ScalarType;
 using executorch::aten::Tensor;
@@ -67,6 +78,9 @@ using executorch::runtime::Result;
 using executorch::runtime::Span;
 using executorch::runtime::Tag;
 using executorch::runtime::TensorInfo;
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+using alif::executorch_utils::CachedDataLoader;
+#endif
 
 #if defined(CONFIG_ARM_ETHOS_U)
 extern "C" executorch::runtime::Error
@@ -118,6 +132,18 @@ const size_t temp_allocation_pool_size =
 unsigned char __attribute__((
     section(".alif_sram0.tensor_arena"),
     aligned(16))) temp_allocation_pool[temp_allocation_pool_size];
+/**
+ * Segments of the program are copied from where the model is stored into the
+ * model_cache_pool when the runtime loads them, so that the Ethos-U DMA reads
+ * command stream and weights from SRAM without copying the whole model at
+ * boot.
+ */
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+unsigned char __attribute__((
+    section(".alif_sram0.tensor_arena"),
+    aligned(16))) model_cache_pool[CONFIG_EXECUTORCH_MODEL_CACHE_SIZE];
+#endif
+
 #if defined(ET_ARM_BAREMETAL_FAST_SCRATCH_TEMP_ALLOCATOR_POOL_SIZE)
 extern "C" {
 size_t ethosu_fast_scratch_size =
@@ -233,12 +259,36 @@ int main(void) {
 #endif
   executorch::runtime::runtime_init();
   std::vector<std::pair<char*, size_t>> input_buffers;
+
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE_FLASH)
+  const struct device* model_flash = FIXED_PARTITION_DEVICE(model_partition);
+  if (!device_is_ready(model_flash)) {
+    ET_LOG(Error, "Model flash device %s not ready", model_flash->name);
+    return 1;
+  }
+  const void* program_data = nullptr;
+  size_t program_data_len = FIXED_PARTITION_SIZE(model_partition);
+
+  ET_LOG(
+      Info,
+      "PTE in %s at 0x%lx Size: %zu bytes",
+      model_flash->name,
+      (unsigned long)FIXED_PARTITION_OFFSET(model_partition),
+      program_data_len);
+
+  static CachedDataLoader loader(
+      model_flash,
+      FIXED_PARTITION_OFFSET(model_partition),
+      program_data_len,
+      model_cache_pool,
+      sizeof(model_cache_pool));
+#else
   size_t pte_size = sizeof(model_pte);
 
   ET_LOG(Info, "PTE at %p Size: %lu bytes", model_pte, pte_size);
 
-#if defined(MODEL_IN_RAM)
-  // Find the offset to the embedded Program.
+#if defined(MODEL_IN_RAM) && !defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+  // Copy the whole program to SRAM once, the pre-cache behaviour.
   if (!model_pte_runtime_initialized) {
     std::memcpy(model_pte_runtime, model_pte, sizeof(model_pte));
     model_pte_runtime_initialized = true;
@@ -247,10 +297,18 @@ int main(void) {
 #else
   const void* program_data = model_pte;
 #endif
-
   size_t program_data_len = pte_size;
 
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+  static CachedDataLoader loader(
+      program_data,
+      program_data_len,
+      model_cache_pool,
+      sizeof(model_cache_pool));
+#else
   auto loader = BufferDataLoader(program_data, program_data_len);
+#endif
+#endif
   ET_LOG(Info, "PTE Model data loaded. Size: %lu bytes.", program_data_len);
 
   // Parse the program file. This is immutable, and can also be reused
@@ -288,7 +346,7 @@ int main(void) {
       "Setup Method allocator pool. Size: %zu bytes.",
       method_allocation_pool_size);
 
-  ArmMemoryAllocator method_allocator(
+  PeakArmMemoryAllocator method_allocator(
       method_allocation_pool_size, method_allocation_pool);
 
   std::vector<uint8_t*> planned_buffers; // Owns the memory
@@ -320,7 +378,7 @@ int main(void) {
   HierarchicalAllocator planned_memory(
       {planned_spans.data(), planned_spans.size()});
 
-  ArmMemoryAllocator temp_allocator(
+  PeakArmMemoryAllocator temp_allocator(
       temp_allocation_pool_size, temp_allocation_pool);
 
   MemoryManager memory_manager(
@@ -424,7 +482,25 @@ int main(void) {
   size_t executor_memsize = method_allocator.used_size() - executor_membase;
 
   ET_LOG(Info, "model_pte_program_size:     %lu bytes.", program_data_len);
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+  {
+    const auto stats = loader.stats();
+    ET_LOG(Info, "model_pte_loaded_size:      %zu bytes.", stats.bytes_loaded);
+    ET_LOG(
+        Info,
+        "model_cache: %u hits, %u misses, %u evictions, %u in place, "
+        "hit rate %u%%, peak %zu / %zu",
+        (unsigned int)stats.hits,
+        (unsigned int)stats.misses,
+        (unsigned int)stats.evictions,
+        (unsigned int)stats.bypasses,
+        (unsigned int)loader.hit_rate(),
+        stats.cache_peak,
+        stats.cache_size);
+  }
+#else
   ET_LOG(Info, "model_pte_loaded_size:      %lu bytes.", pte_size);
+#endif
   if (method_allocator.size() != 0) {
     size_t method_allocator_used = method_allocator.used_size();
     ET_LOG(
@@ -440,6 +516,23 @@ int main(void) {
     ET_LOG(Info, "method_allocator_input:    %zu bytes", input_memsize);
     ET_LOG(Info, "method_allocator_executor: %zu bytes", executor_memsize);
   }
+  ET_LOG(
+      Info,
+      "temp_allocator_peak:       %zu / %zu",
+      temp_allocator.peak_size(),
+      temp_allocator.size());
+  report_arena_hwm(
+      method_name,
+      "method",
+      "ET_ARM_METHOD_ALLOCATOR_POOL_SIZE",
+      method_allocator.peak_size(),
+      method_allocation_pool_size);
+  report_arena_hwm(
+      method_name,
+      "temp",
+      "ET_ARM_BAREMETAL_SCRATCH_TEMP_ALLOCATOR_POOL_SIZE",
+      temp_allocator.peak_size(),
+      temp_allocation_pool_size);
 
   if (status != Error::Ok) {
     ET_LOG(
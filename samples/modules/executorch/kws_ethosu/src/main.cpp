@@ -13,6 +13,7 @@
 
 #include <errno.h>
 #include <executorch/examples/arm/executor_runner/arm_memory_allocator.h>
+#include <executorch/examples/arm/executor_runner/arm_peak_memory_allocator.h>
 #include <executorch/extension/data_loader/buffer_data_loader.h>
 #include <executorch/extension/runner_util/inputs.h>
 #include <executorch/runtime/core/memory_allocator.h>
@@ -28,7 +29,11 @@
 #include <memory>
 #include <vector>
 
+#include "FeatureNormalise.hpp"
 #include "model_pte.h"
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+#include "cached_data_loader.h"
+#endif
 #include "kws_input.h"
 #include "kws_output.h"
 
@@ -50,6 +55,11 @@ using executorch::runtime::Span;
 using executorch::runtime::Tag;
 using executorch::runtime::TensorInfo;
 
+// The reference input is uint8 MFCC features with zero point 128 and scale
+// 1/128; float models take the dequantised values.
+constexpr float kInputScale = 1.0f / 128.0f;
+constexpr int kInputZeroPoint = 128;
+
 #if defined(CONFIG_ARM_ETHOS_U)
 extern "C" executorch::runtime::Error
 executorch_delegate_EthosUBackend_registered(void);
@@ -77,6 +87,12 @@ unsigned char __attribute__((
     section(".alif_sram0.tensor_arena"),
     aligned(16))) temp_allocation_pool[temp_allocation_pool_size];
 
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+unsigned char __attribute__((
+    section(".alif_sram0.tensor_arena"),
+    aligned(16))) model_cache_pool[CONFIG_EXECUTORCH_MODEL_CACHE_SIZE];
+#endif
+
 #if defined(ET_ARM_BAREMETAL_FAST_SCRATCH_TEMP_ALLOCATOR_POOL_SIZE)
 extern "C" {
 size_t ethosu_fast_scratch_size =
@@ -142,10 +158,9 @@ Result<BufferCleanup> prepare_input_tensors(
 
     if (scalar_type == ScalarType::Float && input_size == num_elements) {
       ET_LOG(Info, "Converting uint8 input (%zu elements) to float32", input_size);
-      float* float_data = static_cast<float*>(data_ptr);
-      for (size_t j = 0; j < input_size; j++) {
-        float_data[j] = (static_cast<float>(input_data[j]) - 128.0f) / 128.0f;
-      }
+      arm::app::audio::DequantiseFeatures(
+          input_data, static_cast<float*>(data_ptr), input_size,
+          kInputScale, kInputZeroPoint);
     } else if (input_size == tensor_meta->nbytes()) {
       ET_LOG(Info, "Copying input data to tensor (%zu bytes)", input_size);
       std::memcpy(data_ptr, input_data, input_size);
@@ -287,7 +302,15 @@ int main(void) {
   const void* program_data = model_pte;
   size_t program_data_len = pte_size;
 
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+  static alif::executorch_utils::CachedDataLoader loader(
+      program_data,
+      program_data_len,
+      model_cache_pool,
+      sizeof(model_cache_pool));
+#else
   auto loader = BufferDataLoader(program_data, program_data_len);
+#endif
   ET_LOG(Info, "Model data loaded. Size: %lu bytes.", program_data_len);
 
   Result<Program> program = Program::load(&loader);
@@ -325,7 +348,7 @@ int main(void) {
       "Method allocator pool size: %zu bytes",
       method_allocation_pool_size);
 
-  ArmMemoryAllocator method_allocator(
+  PeakArmMemoryAllocator method_allocator(
       method_allocation_pool_size, method_allocation_pool);
 
   std::vector<uint8_t*> planned_buffers;
@@ -350,7 +373,7 @@ int main(void) {
   HierarchicalAllocator planned_memory(
       {planned_spans.data(), planned_spans.size()});
 
-  ArmMemoryAllocator temp_allocator(
+  PeakArmMemoryAllocator temp_allocator(
       temp_allocation_pool_size, temp_allocation_pool);
 
   MemoryManager memory_manager(
@@ -407,6 +430,37 @@ int main(void) {
   }
   ET_LOG(Info, "Inference completed in %u ms", inference_time);
 
+  report_arena_hwm(
+      "kws",
+      "method",
+      "ET_ARM_METHOD_ALLOCATOR_POOL_SIZE",
+      method_allocator.peak_size(),
+      method_allocation_pool_size);
+  report_arena_hwm(
+      "kws",
+      "temp",
+      "ET_ARM_BAREMETAL_SCRATCH_TEMP_ALLOCATOR_POOL_SIZE",
+      temp_allocator.peak_size(),
+      temp_allocation_pool_size);
+
+#if defined(CONFIG_EXECUTORCH_MODEL_CACHE)
+  {
+    const auto stats = loader.stats();
+    ET_LOG(
+        Info,
+        "Model cache: %u hits, %u misses, %u evictions, %u in place, "
+        "hit rate %u%%, %zu bytes copied, peak %zu/%zu bytes",
+        (unsigned int)stats.hits,
+        (unsigned int)stats.misses,
+        (unsigned int)stats.evictions,
+        (unsigned int)stats.bypasses,
+        (unsigned int)loader.hit_rate(),
+        stats.bytes_loaded,
+        stats.cache_peak,
+        stats.cache_size);
+  }
+#endif
+
   std::vector<EValue> outputs(method->outputs_size());
   status = method->get_outputs(outputs.data(), outputs.size());
   ET_CHECK(status == Error::Ok);
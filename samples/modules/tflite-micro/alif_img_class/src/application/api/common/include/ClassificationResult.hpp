@@ -17,8 +17,8 @@
 #ifndef CLASSIFICATION_RESULT_HPP
 #define CLASSIFICATION_RESULT_HPP
 
+#include <array>
 #include <cstdint>
-#include <string>
 
 namespace arm {
 namespace app {
@@ -29,13 +29,43 @@ namespace app {
     class ClassificationResult {
     public:
         double          m_normalisedVal = 0.0;
-        std::string     m_label;
         uint32_t        m_labelIdx = 0;
 
         ClassificationResult() = default;
         ~ClassificationResult() = default;
     };
 
+    /**
+     * @brief   Fixed capacity list of classification results, best first.
+     *          Lives outside the heap so it can be refilled every frame.
+     */
+    class ClassificationResults {
+    public:
+        static constexpr uint32_t ms_capacity = 8;
+
+        void Clear() { m_count = 0; }
+
+        bool PushBack(const ClassificationResult& result)
+        {
+            if (m_count == ms_capacity) {
+                return false;
+            }
+            m_results[m_count++] = result;
+            return true;
+        }
+
+        uint32_t size() const { return m_count; }
+
+        const ClassificationResult& operator[](uint32_t i) const { return m_results[i]; }
+
+        const ClassificationResult* begin() const { return m_results.data(); }
+        const ClassificationResult* end() const { return m_results.data() + m_count; }
+
+    private:
+        std::array<ClassificationResult, ms_capacity> m_results{};
+        uint32_t m_count = 0;
+    };
+
 } /* namespace app */
 } /* namespace arm */
 
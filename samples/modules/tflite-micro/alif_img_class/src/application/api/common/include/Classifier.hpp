@@ -20,6 +20,7 @@
 #include "ClassificationResult.hpp"
 #include "TensorFlowLiteMicro.hpp"
 
+#include <string>
 #include <vector>
 
 namespace arm {
@@ -40,49 +41,32 @@ namespace app {
          * @brief       Gets the top N classification results from the
          *              output vector.
          * @param[in]   outputTensor   Inference output tensor from an NN model.
-         * @param[out]  vecResults     A vector of classification results.
+         * @param[out]  results        Classification results, best first,
          *                             populated by this function.
-         * @param[in]   labels         Labels vector to match classified classes.
-         * @param[in]   topNCount      Number of top classifications to pick.
+         * @param[in]   labels         Labels vector, used to validate the output size.
+         * @param[in]   topNCount      Number of top classifications to pick, at most
+         *                             ClassificationResults::ms_capacity.
          * @param[in]   useSoftmax     Whether Softmax normalisation should be applied to output.
          * @return      true if successful, false otherwise.
          **/
 
         virtual bool GetClassificationResults(
             TfLiteTensor* outputTensor,
-            std::vector<ClassificationResult>& vecResults,
+            ClassificationResults& results,
             const std::vector <std::string>& labels, uint32_t topNCount,
-            bool use_softmax);
+            bool useSoftmax);
 
         /**
-        * @brief       Populate the elements of the Classification Result object.
-        * @param[in]   topNSet        Ordered set of top 5 output class scores and labels.
-        * @param[out]  vecResults     A vector of classification results.
-        *                             populated by this function.
-        * @param[in]   labels         Labels vector to match classified classes.
-        **/
-
-        void SetVectorResults(
-            std::set<std::pair<float, uint32_t>>& topNSet,
-            std::vector<ClassificationResult>& vecResults,
-            const std::vector <std::string>& labels);
-
-    protected:
-        /**
-         * @brief       Utility function that gets the top N classification results from the
-         *              output vector.
-         * @param[in]   tensor       Inference output tensor from an NN model.
-         * @param[out]  vecResults   A vector of classification results
-         *                           populated by this function.
+         * @brief       Utility function that picks the indices of the top N
+         *              elements of the raw output vector.
+         * @param[in]   data         Raw (quantised or float) output values.
+         * @param[in]   size         Number of output values.
          * @param[in]   topNCount    Number of top classifications to pick.
-         * @param[in]   labels       Labels vector to match classified classes.
-         * @return      true if successful, false otherwise.
+         * @param[out]  topIdx       Indices of the largest values, best first.
          **/
-
-        bool GetTopNResults(const std::vector<float>& tensor,
-                            std::vector<ClassificationResult>& vecResults,
-                            uint32_t topNCount,
-                            const std::vector <std::string>& labels);
+        template <typename T>
+        static void GetTopNIndices(const T* data, uint32_t size, uint32_t topNCount,
+                                   uint32_t* topIdx);
     };
 
 } /* namespace app */
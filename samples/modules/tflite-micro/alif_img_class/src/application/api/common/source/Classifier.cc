@@ -17,11 +17,10 @@
 #include "Classifier.hpp"
 
 #include "TensorFlowLiteMicro.hpp"
-#include "PlatformMath.hpp"
 
 #include <vector>
 #include <string>
-#include <set>
+#include <cmath>
 #include <cstdint>
 #include <cinttypes>
 #include <zephyr/logging/log.h>
@@ -33,55 +32,80 @@ namespace arm
 namespace app
 {
 
-void Classifier::SetVectorResults(std::set<std::pair<float, uint32_t>> &topNSet,
-				  std::vector<ClassificationResult> &vecResults,
-				  const std::vector<std::string> &labels)
+template <typename T>
+void Classifier::GetTopNIndices(const T *data, uint32_t size, uint32_t topNCount,
+				uint32_t *topIdx)
 {
-	/* Reset the iterator to the largest element - use reverse iterator. */
+	uint32_t count = 0;
 
-	auto topNIter = topNSet.rbegin();
-	for (size_t i = 0; i < vecResults.size() && topNIter != topNSet.rend(); ++i, ++topNIter) {
-		vecResults[i].m_normalisedVal = topNIter->first;
-		vecResults[i].m_label = labels[topNIter->second];
-		vecResults[i].m_labelIdx = topNIter->second;
+	/* Insertion into a short sorted list; most elements fail the first compare. */
+	for (uint32_t i = 0; i < size; ++i) {
+		const T value = data[i];
+
+		if (count == topNCount && !(value > data[topIdx[count - 1]])) {
+			continue;
+		}
+
+		uint32_t j = count < topNCount ? count++ : count - 1;
+
+		for (; j > 0 && value > data[topIdx[j - 1]]; --j) {
+			topIdx[j] = topIdx[j - 1];
+		}
+		topIdx[j] = i;
 	}
 }
 
-bool Classifier::GetTopNResults(const std::vector<float> &tensor,
-				std::vector<ClassificationResult> &vecResults, uint32_t topNCount,
-				const std::vector<std::string> &labels)
+template <typename T>
+static float Dequantise(const T *data, uint32_t idx, const QuantParams &quantParams)
 {
-	std::set<std::pair<float, uint32_t>> sortedSet;
+	return quantParams.scale * (static_cast<float>(data[idx]) - quantParams.offset);
+}
 
-	/* NOTE: inputVec's size verification against labels should be
-	 *       checked by the calling/public function. */
+static float Dequantise(const float *data, uint32_t idx, const QuantParams &)
+{
+	return data[idx];
+}
 
-	/* Set initial elements. */
-	for (uint32_t i = 0; i < topNCount; ++i) {
-		sortedSet.insert({tensor[i], i});
+/* Fill the results from the winners; only these are dequantised. */
+template <typename T>
+static void SetResults(const T *data, uint32_t size, const uint32_t *topIdx, uint32_t topNCount,
+		       const QuantParams &quantParams, bool useSoftmax,
+		       ClassificationResults &results)
+{
+	float sum = 1.0f;
+	const float maxVal = Dequantise(data, topIdx[0], quantParams);
+
+	if (useSoftmax) {
+		sum = 0.0f;
+		for (uint32_t i = 0; i < size; ++i) {
+			sum += std::exp(Dequantise(data, i, quantParams) - maxVal);
+		}
 	}
 
-	/* Initialise iterator. */
-	auto setFwdIter = sortedSet.begin();
+	for (uint32_t i = 0; i < topNCount; ++i) {
+		ClassificationResult result;
+		const float val = Dequantise(data, topIdx[i], quantParams);
 
-	/* Scan through the rest of elements with compare operations. */
-	for (uint32_t i = topNCount; i < labels.size(); ++i) {
-		if (setFwdIter->first < tensor[i]) {
-			sortedSet.erase(*setFwdIter);
-			sortedSet.insert({tensor[i], i});
-			setFwdIter = sortedSet.begin();
-		}
+		result.m_normalisedVal = useSoftmax ? std::exp(val - maxVal) / sum : val;
+		result.m_labelIdx = topIdx[i];
+		results.PushBack(result);
 	}
+}
 
-	/* Final results' container. */
-	vecResults = std::vector<ClassificationResult>(topNCount);
-	SetVectorResults(sortedSet, vecResults, labels);
+template <typename T>
+static void Classify(const T *data, uint32_t size, uint32_t topNCount,
+		     const QuantParams &quantParams, bool useSoftmax,
+		     ClassificationResults &results)
+{
+	/* Softmax and dequantisation are monotonic, so rank on the raw values */
+	uint32_t topIdx[ClassificationResults::ms_capacity];
 
-	return true;
+	Classifier::GetTopNIndices(data, size, topNCount, topIdx);
+	SetResults(data, size, topIdx, topNCount, quantParams, useSoftmax, results);
 }
 
 bool Classifier::GetClassificationResults(TfLiteTensor *outputTensor,
-					  std::vector<ClassificationResult> &vecResults,
+					  ClassificationResults &results,
 					  const std::vector<std::string> &labels,
 					  uint32_t topNCount, bool useSoftmax)
 {
@@ -105,62 +129,34 @@ bool Classifier::GetClassificationResults(TfLiteTensor *outputTensor,
 	} else if (topNCount == 0) {
 		LOG_ERR("Top N results cannot be zero");
 		return false;
+	} else if (topNCount > ClassificationResults::ms_capacity) {
+		LOG_ERR("Top N results cannot exceed %" PRIu32 "", ClassificationResults::ms_capacity);
+		return false;
 	}
 
-	bool resultState;
-	vecResults.clear();
+	results.Clear();
 
-	/* De-Quantize Output Tensor */
 	QuantParams quantParams = GetTensorQuantParams(outputTensor);
 
-	/* Floating point tensor data to be populated
-	 * NOTE: The assumption here is that the output tensor size isn't too
-	 * big and therefore, there's neglibible impact on heap usage. */
-	std::vector<float> tensorData(totalOutputSize);
-
-	/* Populate the floating point buffer */
 	switch (outputTensor->type) {
-	case kTfLiteUInt8: {
-		uint8_t *tensor_buffer = tflite::GetTensorData<uint8_t>(outputTensor);
-		for (size_t i = 0; i < totalOutputSize; ++i) {
-			tensorData[i] = quantParams.scale *
-					(static_cast<float>(tensor_buffer[i]) - quantParams.offset);
-		}
+	case kTfLiteUInt8:
+		Classify(tflite::GetTensorData<uint8_t>(outputTensor), totalOutputSize, topNCount,
+			 quantParams, useSoftmax, results);
 		break;
-	}
-	case kTfLiteInt8: {
-		int8_t *tensor_buffer = tflite::GetTensorData<int8_t>(outputTensor);
-		for (size_t i = 0; i < totalOutputSize; ++i) {
-			tensorData[i] = quantParams.scale *
-					(static_cast<float>(tensor_buffer[i]) - quantParams.offset);
-		}
+	case kTfLiteInt8:
+		Classify(tflite::GetTensorData<int8_t>(outputTensor), totalOutputSize, topNCount,
+			 quantParams, useSoftmax, results);
 		break;
-	}
-	case kTfLiteFloat32: {
-		float *tensor_buffer = tflite::GetTensorData<float>(outputTensor);
-		for (size_t i = 0; i < totalOutputSize; ++i) {
-			tensorData[i] = tensor_buffer[i];
-		}
+	case kTfLiteFloat32:
+		Classify(tflite::GetTensorData<float>(outputTensor), totalOutputSize, topNCount,
+			 quantParams, useSoftmax, results);
 		break;
-	}
 	default:
 		LOG_ERR("Tensor type %s not supported by classifier",
 			   TfLiteTypeGetName(outputTensor->type));
 		return false;
 	}
 
-	if (useSoftmax) {
-		math::MathUtils::SoftmaxF32(tensorData);
-	}
-
-	/* Get the top N results. */
-	resultState = GetTopNResults(tensorData, vecResults, topNCount, labels);
-
-	if (!resultState) {
-		LOG_ERR("Failed to get top N results set");
-		return false;
-	}
-
 	return true;
 }
 } /* namespace app */
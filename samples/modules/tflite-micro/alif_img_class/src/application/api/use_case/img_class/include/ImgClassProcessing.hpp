@@ -65,11 +65,11 @@ namespace app {
          * @param[in]   outputTensor  Pointer to the TFLite Micro output Tensor.
          * @param[in]   classifier    Classifier object used to get top N results from classification.
          * @param[in]   labels        Vector of string labels to identify each output of the model.
-         * @param[in]   results       Vector of classification results to store decoded outputs.
+         * @param[in]   results       Classification results to store decoded outputs.
          **/
         ImgClassPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
                             const std::vector<std::string>& labels,
-                            std::vector<ClassificationResult>& results);
+                            ClassificationResults& results);
 
         /**
          * @brief       Should perform post-processing of the result of inference then
@@ -82,7 +82,7 @@ namespace app {
         TfLiteTensor* m_outputTensor;
         Classifier& m_imgClassifier;
         const std::vector<std::string>& m_labels;
-        std::vector<ClassificationResult>& m_results;
+        ClassificationResults& m_results;
     };
 
 } /* namespace app */
@@ -50,7 +50,7 @@ namespace app {
 
     ImgClassPostProcess::ImgClassPostProcess(TfLiteTensor* outputTensor, Classifier& classifier,
                                              const std::vector<std::string>& labels,
-                                             std::vector<ClassificationResult>& results)
+                                             ClassificationResults& results)
             :m_outputTensor{outputTensor},
              m_imgClassifier{classifier},
              m_labels{labels},
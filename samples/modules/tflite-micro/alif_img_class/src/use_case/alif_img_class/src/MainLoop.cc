@@ -70,6 +70,10 @@ void main_loop()
     GetLabelsVector(labels);
     caseContext.Set<const std::vector <std::string>&>("labels", labels);
 
+    /* Refilled by every inference; kept here so the handler does not allocate. */
+    arm::app::ClassificationResults results;
+    caseContext.Set<arm::app::ClassificationResults&>("results", results);
+
     /* Loop. */
     do {
         alif::app::ClassifyImageHandler(caseContext);
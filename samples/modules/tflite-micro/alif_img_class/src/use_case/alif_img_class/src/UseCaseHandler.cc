@@ -94,7 +94,8 @@ namespace app {
 
     using namespace arm::app;
 
-    bool PresentInferenceResult(const std::vector<arm::app::ClassificationResult>& results)
+    bool PresentInferenceResult(const ClassificationResults& results,
+                                const std::vector<std::string>& labels)
     {
 
         LOG_INF("Final results:");
@@ -105,16 +106,17 @@ namespace app {
                 i,
                 results[i].m_labelIdx,
                 results[i].m_normalisedVal,
-                results[i].m_label.c_str());
+                labels[results[i].m_labelIdx].c_str());
         }
 
         return true;
     }
 
-    static std::string first_bit(const std::string &s)
+    /* Length of the first comma separated name of a label. */
+    static int first_bit_len(const std::string &s)
     {
         std::string::size_type comma = s.find_first_of(',');
-        return s.substr(0, comma);
+        return comma == std::string::npos ? s.size() : comma;
     }
 
     bool ClassifyImageInit()
@@ -171,10 +173,10 @@ namespace app {
         /* Set up pre and post-processing. */
         ImgClassPreProcess preProcess = ImgClassPreProcess(inputTensor, model.IsDataSigned());
 
-        std::vector<ClassificationResult> results;
+        const std::vector<std::string>& labels = ctx.Get<const std::vector<std::string>&>("labels");
+        ClassificationResults& results = ctx.Get<ClassificationResults&>("results");
         ImgClassPostProcess postProcess = ImgClassPostProcess(outputTensor,
-                ctx.Get<ImgClassClassifier&>("classifier"), ctx.Get<const std::vector<std::string>&>("labels"),
-                results);
+                ctx.Get<ImgClassClassifier&>("classifier"), labels, results);
 
         uint8_t* image_data = nullptr;
         if(get_image_data(&image_data) < 0) {
@@ -215,13 +217,11 @@ namespace app {
             return false;
         }
 
-        /* Add results to context for access outside handler. */
-        ctx.Set<std::vector<ClassificationResult>>("results", results);
-
         k_mutex_lock(&lvgl_mutex, K_FOREVER);
         for (int r = 0; r < 3; r++) {
             lv_obj_t *label = ScreenLayoutLabelObject(r);
-            lv_label_set_text_fmt(label, "%s (%d%%)", first_bit(results[r].m_label).c_str(), (int)(results[r].m_normalisedVal * 100));
+            const std::string& name = labels[results[r].m_labelIdx];
+            lv_label_set_text_fmt(label, "%.*s (%d%%)", first_bit_len(name), name.c_str(), (int)(results[r].m_normalisedVal * 100));
             if (results[r].m_normalisedVal >= 0.7) {
                 lv_obj_add_state(label, LV_STATE_USER_1);
             } else {
@@ -236,7 +236,7 @@ namespace app {
 
         k_mutex_unlock(&lvgl_mutex);
 
-        if (!PresentInferenceResult(results)) {
+        if (!PresentInferenceResult(results, labels)) {
             return false;
         }
 
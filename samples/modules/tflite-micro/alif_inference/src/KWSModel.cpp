@@ -2,7 +2,7 @@
 
 #include "KWSModel.h"
 
-#include "mfcc/PlatformMath.hpp"
+#include "PlatformMath.hpp"
 #include "mfcc/MicroNetKwsModel.hpp"
 #include "BufAttributes.hpp"
 
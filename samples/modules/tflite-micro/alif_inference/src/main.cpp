@@ -15,14 +15,14 @@ template <typename T>
 class PrintHighestConfidence
 {
 public:
-	void ProcessOutput(const T &result)
+	void ProcessOutput(const T &result, const InferenceFrameInfo &info)
 	{
 		const auto it =
 			std::max_element(result.confidences.begin(), result.confidences.end());
 		const auto highest_idx = std::distance(result.confidences.begin(), it);
 
-		LOG_INF("%s: %f", T::Result::GetLabelName(highest_idx),
-			static_cast<double>(result.confidences[highest_idx]));
+		LOG_INF("%s: %f (latency %u us)", T::Result::GetLabelName(highest_idx),
+			static_cast<double>(result.confidences[highest_idx]), info.latencyUs);
 	}
 };
 
@@ -97,6 +97,77 @@ namespace app {
                     std::function<std::vector<T> (std::vector<int16_t>& )> compute);
     };
 
+    /**
+     * @brief   Streaming pre-processing class for Keyword Spotting use case.
+     *          Takes audio one stride at a time and computes MFCC features only for the
+     *          frames that the new samples complete. The input tensor holds the most recent
+     *          numFeatureFrames feature vectors in time order: on each stride the existing
+     *          rows are moved up and the new ones are written straight into the tail.
+     *          Only the last (mfccFrameLength - mfccFrameStride) samples of the previous
+     *          stride are kept, so the caller does not need to keep a whole window of audio.
+     *          No memory is allocated after construction. With CONFIG_KWS_MFCC_FIXED_POINT
+     *          the features are computed by the Q15 MFCC implementation.
+     */
+    class KwsStreamingPreProcess : public BasePreProcess {
+
+    public:
+        /**
+         * @brief       Constructor
+         * @param[in]   inputTensor        Pointer to the TFLite Micro input Tensor.
+         * @param[in]   numFeatures        How many MFCC features to use.
+         * @param[in]   numFeatureFrames   Number of MFCC vectors that need to be calculated
+         *                                 for an inference.
+         * @param[in]   mfccFrameLength    Number of audio samples used to calculate one set of MFCC values.
+         * @param[in]   mfccFrameStride    Number of audio samples between consecutive frames.
+         * @param[in]   audioDataStride    Number of new audio samples passed to each DoPreProcess call,
+         *                                 must be a multiple of mfccFrameStride.
+         **/
+        KwsStreamingPreProcess(TfLiteTensor* inputTensor, size_t numFeatures, size_t numFeatureFrames,
+                               int mfccFrameLength, int mfccFrameStride, size_t audioDataStride);
+
+        /**
+         * @brief       Computes features for one stride of new audio and updates the input tensor.
+         * @param[in]   input            Pointer to audioDataStride new audio samples.
+         * @param[in]   inferenceIndex   Index of the stride, 0 restarts the stream with the
+         *                               window filled with silence.
+         * @return      true if successful, false otherwise.
+         **/
+        bool DoPreProcess(const void* input, size_t inferenceIndex = 0) override;
+
+        /** @brief  Returns true if the parameters allow streaming operation. */
+        bool IsValid() const;
+
+        size_t m_audioDataWindowSize;   /* Amount of audio covered by the input tensor. */
+        size_t m_audioDataStride;       /* Amount of new audio per call. */
+
+    private:
+        TfLiteTensor* m_inputTensor;    /* Model input tensor. */
+        const size_t m_numMfccFeatures;
+        const size_t m_numMfccFrames;   /* How many sets of m_numMfccFeatures. */
+        const size_t m_mfccFrameLength;
+        const size_t m_mfccFrameStride;
+        const size_t m_overlap;         /* Samples a frame shares with the next one. */
+        size_t m_featureBytes;          /* Size of one feature vector in the tensor. */
+        float m_quantScale;
+        int m_quantOffset;
+        bool m_valid;
+
+#if defined(CONFIG_KWS_MFCC_FIXED_POINT)
+        audio::MicroNetKwsMFCCQ15 m_mfcc;
+#else
+        audio::MicroNetKwsMFCC m_mfcc;
+#endif
+        std::vector<int16_t> m_history;   /* Tail of the previous stride. */
+        std::vector<int16_t> m_frame;     /* Frame straddling the previous and new stride. */
+        std::vector<float> m_features;    /* Float features before quantisation. */
+
+        /** @brief  Computes features for one frame into row @p row of the input tensor. */
+        void ComputeFrame(const int16_t* frame, size_t row);
+
+        /** @brief  Fills every row of the input tensor with the features of silence. */
+        void Reset();
+    };
+
     /**
      * @brief   Post-processing class for Keyword Spotting use case.
      *          Implements methods declared by BasePostProcess and anything else needed
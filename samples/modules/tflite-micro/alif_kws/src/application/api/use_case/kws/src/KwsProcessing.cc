@@ -18,6 +18,9 @@
 #include "MicroNetKwsModel.hpp"
 #include <zephyr/logging/log.h>
 
+#include <algorithm>
+#include <cstring>
+
 LOG_MODULE_REGISTER(KwsPreProcess);
 
 namespace arm
@@ -190,6 +193,151 @@ KwsPreProcess::GetFeatureCalculator(audio::MicroNetKwsMFCC &mfcc, TfLiteTensor *
 	return mfccFeatureCalc;
 }
 
+KwsStreamingPreProcess::KwsStreamingPreProcess(TfLiteTensor *inputTensor, size_t numFeatures,
+					       size_t numMfccFrames, int mfccFrameLength,
+					       int mfccFrameStride, size_t audioDataStride)
+	: m_audioDataStride{audioDataStride}, m_inputTensor{inputTensor},
+	  m_numMfccFeatures{numFeatures}, m_numMfccFrames{numMfccFrames},
+	  m_mfccFrameLength{static_cast<size_t>(mfccFrameLength)},
+	  m_mfccFrameStride{static_cast<size_t>(mfccFrameStride)},
+	  m_overlap{static_cast<size_t>(mfccFrameLength - mfccFrameStride)}, m_featureBytes{0},
+	  m_quantScale{1.f}, m_quantOffset{0}, m_valid{false},
+	  m_mfcc{numFeatures, static_cast<size_t>(mfccFrameLength)}
+{
+	this->m_mfcc.Init();
+
+	this->m_audioDataWindowSize =
+		this->m_numMfccFrames * this->m_mfccFrameStride + this->m_overlap;
+
+	if (mfccFrameStride <= 0 || mfccFrameLength < mfccFrameStride) {
+		LOG_ERR("Invalid MFCC frame length %d / stride %d", mfccFrameLength,
+			mfccFrameStride);
+		return;
+	}
+
+	if (audioDataStride == 0 || audioDataStride % this->m_mfccFrameStride != 0 ||
+	    audioDataStride < this->m_overlap) {
+		LOG_ERR("Audio stride %zu must be a non-zero multiple of MFCC stride %zu",
+			audioDataStride, this->m_mfccFrameStride);
+		return;
+	}
+
+	TfLiteQuantization quant = inputTensor->quantization;
+
+	if (kTfLiteAffineQuantization == quant.type) {
+		if (inputTensor->type != kTfLiteInt8) {
+			LOG_ERR("Tensor type %s not supported",
+				TfLiteTypeGetName(inputTensor->type));
+			return;
+		}
+
+		auto *quantParams = (TfLiteAffineQuantization *)quant.params;
+		this->m_quantScale = quantParams->scale->data[0];
+		this->m_quantOffset = quantParams->zero_point->data[0];
+		this->m_featureBytes = this->m_numMfccFeatures * sizeof(int8_t);
+	} else {
+		this->m_featureBytes = this->m_numMfccFeatures * sizeof(float);
+	}
+
+	this->m_history = std::vector<int16_t>(this->m_overlap, 0);
+	this->m_frame = std::vector<int16_t>(this->m_mfccFrameLength, 0);
+	this->m_features = std::vector<float>(this->m_numMfccFeatures);
+	this->m_valid = true;
+}
+
+bool KwsStreamingPreProcess::IsValid() const
+{
+	return this->m_valid;
+}
+
+void KwsStreamingPreProcess::ComputeFrame(const int16_t *frame, size_t row)
+{
+	auto *tensorData = tflite::GetTensorData<uint8_t>(this->m_inputTensor);
+	void *dst = tensorData + row * this->m_featureBytes;
+
+	if (this->m_inputTensor->type == kTfLiteInt8) {
+		this->m_mfcc.MfccComputeQuant<int8_t>(frame, this->m_quantScale,
+						      this->m_quantOffset,
+						      static_cast<int8_t *>(dst));
+	} else {
+		this->m_mfcc.MfccCompute(frame, static_cast<float *>(dst));
+	}
+}
+
+void KwsStreamingPreProcess::Reset()
+{
+	auto *tensorData = tflite::GetTensorData<uint8_t>(this->m_inputTensor);
+
+	std::fill(this->m_history.begin(), this->m_history.end(), 0);
+	std::fill(this->m_frame.begin(), this->m_frame.end(), 0);
+
+	/* Features of silence are the same for every frame, compute them once. */
+	this->ComputeFrame(this->m_frame.data(), 0);
+	for (size_t row = 1; row < this->m_numMfccFrames; ++row) {
+		std::memcpy(tensorData + row * this->m_featureBytes, tensorData,
+			    this->m_featureBytes);
+	}
+}
+
+bool KwsStreamingPreProcess::DoPreProcess(const void *data, size_t inferenceIndex)
+{
+	if (!this->m_valid) {
+		LOG_ERR("Streaming pre-processing not initialised");
+		return false;
+	}
+
+	if (data == nullptr) {
+		LOG_ERR("Data pointer is null");
+		return false;
+	}
+
+	auto input = static_cast<const int16_t *>(data);
+	auto *tensorData = tflite::GetTensorData<uint8_t>(this->m_inputTensor);
+
+	if (inferenceIndex == 0) {
+		this->Reset();
+	}
+
+	/* Each stride completes this many frames. When it is longer than the tensor window
+	 * the oldest new frames would be shifted out again, so skip computing them. */
+	const size_t newFrames = this->m_audioDataStride / this->m_mfccFrameStride;
+	const size_t skipFrames = newFrames > this->m_numMfccFrames
+					  ? newFrames - this->m_numMfccFrames
+					  : 0;
+	const size_t keptFrames = this->m_numMfccFrames - (newFrames - skipFrames);
+
+	/* Age the existing features; this moves feature vectors, not audio. */
+	std::memmove(tensorData, tensorData + (newFrames - skipFrames) * this->m_featureBytes,
+		     keptFrames * this->m_featureBytes);
+
+	for (size_t i = skipFrames; i < newFrames; ++i) {
+		const size_t row = keptFrames + i - skipFrames;
+		const size_t start = i * this->m_mfccFrameStride;
+
+		if (start >= this->m_overlap) {
+			/* Frame lies entirely in the new stride, use it in place. */
+			this->ComputeFrame(input + start - this->m_overlap, row);
+		} else {
+			/* Frame starts in the tail of the previous stride. */
+			const size_t fromHistory = this->m_overlap - start;
+
+			std::copy(this->m_history.begin() + start, this->m_history.end(),
+				  this->m_frame.begin());
+			std::copy(input, input + this->m_mfccFrameLength - fromHistory,
+				  this->m_frame.begin() + fromHistory);
+			this->ComputeFrame(this->m_frame.data(), row);
+		}
+	}
+
+	/* Keep the samples the first frame of the next stride needs. */
+	std::copy(input + this->m_audioDataStride - this->m_overlap,
+		  input + this->m_audioDataStride, this->m_history.begin());
+
+	LOG_DBG("Input tensor updated with %zu new frames", newFrames - skipFrames);
+
+	return true;
+}
+
 KwsPostProcess::KwsPostProcess(TfLiteTensor *outputTensor, KwsClassifier &classifier,
 			       const std::vector<std::string> &labels,
 			       std::vector<ClassificationResult> &results,
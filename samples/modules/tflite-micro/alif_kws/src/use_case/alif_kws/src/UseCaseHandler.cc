@@ -32,7 +32,7 @@ using arm::app::ApplicationContext;
 using arm::app::ClassificationResult;
 using arm::app::KwsClassifier;
 using arm::app::KwsPostProcess;
-using arm::app::KwsPreProcess;
+using arm::app::KwsStreamingPreProcess;
 using arm::app::MicroNetKwsModel;
 using arm::app::Model;
 
@@ -40,7 +40,9 @@ using arm::app::Model;
 #define AUDIO_STRIDE   CONFIG_AUDIO_STRIDE
 #define RESULTS_MEMORY CONFIG_RESULTS_MEMORY
 
-static int16_t audio_inf[AUDIO_SAMPLES + AUDIO_STRIDE];
+/* Ping-pong stride buffers: one is filled by the audio backend while the other is processed.
+ * The pre-processing keeps the little history it needs, so no audio window is kept here. */
+static int16_t audio_inf[2][AUDIO_STRIDE];
 
 namespace alif
 {
@@ -105,8 +107,15 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 	const float secondsPerSample = 1.0f / audioRate;
 
 	/* Set up pre and post-processing. */
-	KwsPreProcess preProcess = KwsPreProcess(inputTensor, numMfccFeatures, numMfccFrames,
-						 mfccFrameLength, mfccFrameStride);
+	KwsStreamingPreProcess preProcess(inputTensor, numMfccFeatures, numMfccFrames,
+					  mfccFrameLength, mfccFrameStride, AUDIO_STRIDE);
+	if (!preProcess.IsValid()) {
+		return false;
+	}
+	if (preProcess.m_audioDataWindowSize != AUDIO_SAMPLES) {
+		LOG_WRN("Model window is %zu samples, CONFIG_AUDIO_SAMPLES is %d",
+			preProcess.m_audioDataWindowSize, AUDIO_SAMPLES);
+	}
 
 	std::vector<ClassificationResult> singleInfResult;
 	KwsPostProcess postProcess =
@@ -121,8 +130,10 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 		return false;
 	}
 
-	// Start first fill of final stride section of buffer
-	get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+	int fill = 0;
+
+	// Start first fill of the stride buffer
+	get_audio_data(audio_inf[fill], AUDIO_STRIDE);
 
 	do {
 		// Wait until stride buffer is full - initiated above or by previous interation of
@@ -133,21 +144,18 @@ bool ClassifyAudioHandler(ApplicationContext &ctx, bool oneshot)
 			return false;
 		}
 
-		// move buffer down by one stride, clearing space at the end for the next stride
-		std::copy(audio_inf + AUDIO_STRIDE, audio_inf + AUDIO_STRIDE + AUDIO_SAMPLES,
-			  audio_inf);
-
-		// start receiving the next stride immediately before we start heavy processing, so
-		// as not to lose anything
-		get_audio_data(audio_inf + AUDIO_SAMPLES, AUDIO_STRIDE);
+		int16_t *stride = audio_inf[fill];
 
-		audio_preprocessing(audio_inf + AUDIO_SAMPLES - AUDIO_STRIDE, AUDIO_STRIDE);
+		// start receiving the next stride into the other buffer immediately before we
+		// start heavy processing, so as not to lose anything
+		fill ^= 1;
+		get_audio_data(audio_inf[fill], AUDIO_STRIDE);
 
-		const int16_t *inferenceWindow = audio_inf;
+		audio_preprocessing(stride, AUDIO_STRIDE);
 
 		uint32_t start = k_cycle_get_32();
 		/* Run the pre-processing, inference and post-processing. */
-		if (!preProcess.DoPreProcess(inferenceWindow, index)) {
+		if (!preProcess.DoPreProcess(stride, index)) {
 			LOG_ERR("Pre-processing failed.");
 			return false;
 		}
@@ -22,8 +22,13 @@
 #include "YoloFastestModel.hpp"
 #include "BaseProcessing.hpp"
 
+#include <array>
 #include <forward_list>
 
+#if !defined(CONFIG_OBJECT_DETECTION_MAX_CANDIDATES)
+#define CONFIG_OBJECT_DETECTION_MAX_CANDIDATES 64
+#endif
+
 namespace arm {
 namespace app {
 namespace object_detection {
@@ -48,6 +53,15 @@ namespace object_detection {
         float scale;
         int zeroPoint;
         size_t size;
+        int objThreshold{}; /* Raw int8 objectness must exceed this to pass the threshold. */
+    };
+
+    /* Anchor that passed the objectness threshold, not yet decoded. */
+    struct Candidate {
+        float logit;        /* Dequantised objectness before the sigmoid. */
+        uint16_t branch;
+        uint16_t cell;      /* h * resolution + w. */
+        uint16_t anchor;
     };
 
     struct Network {
@@ -93,6 +107,14 @@ namespace object_detection {
         const object_detection::PostProcessParams& m_postProcessParams;  /* Post processing param struct. */
         object_detection::Network m_net;                                 /* YOLO network object. */
 
+        /* Candidates kept before NMS by the int8 path, also when topN <= 0. */
+        static constexpr size_t ms_maxCandidates = CONFIG_OBJECT_DETECTION_MAX_CANDIDATES;
+
+        std::array<object_detection::Candidate, ms_maxCandidates> m_candidates; /* Min-heap on logit. */
+        std::array<image::Box, ms_maxCandidates> m_boxes;                      /* Decoded boxes. */
+        std::array<uint16_t, ms_maxCandidates> m_order;                        /* NMS ordering. */
+        std::vector<float> m_probs;                                            /* Class scores, numClasses per box. */
+
         /**
          * @brief       Insert the given Detection in the list.
          * @param[in]   detections   List of detections.
@@ -113,6 +135,47 @@ namespace object_detection {
                              int imageHeight,
                              float threshold,
                              std::forward_list<image::Detection>& detections);
+
+        /**
+         * @brief        Int8 post-processing: thresholds objectness on the raw
+         *               quantised values, keeps the best candidates in a heap,
+         *               decodes only those and runs NMS on flat arrays.
+         * @param[in]    imageWidth    Original image width.
+         * @param[in]    imageHeight   Original image height.
+         **/
+        void DoPostProcessInt8(int imageWidth, int imageHeight);
+
+        /**
+         * @brief        Scan all branches and collect the anchors whose objectness
+         *               passes the threshold, keeping at most capacity of them.
+         * @param[in]    capacity   Maximum number of candidates to keep.
+         * @param[out]   dropped    Number of passing anchors that did not fit.
+         * @return       Number of candidates in m_candidates.
+         **/
+        size_t SelectCandidates(size_t capacity, size_t& dropped);
+
+        /**
+         * @brief        Decode the box and class scores of a candidate.
+         * @param[in]    cand          Candidate to decode.
+         * @param[in]    imageWidth    Original image width.
+         * @param[in]    imageHeight   Original image height.
+         * @param[out]   box           Decoded box in image coordinates.
+         * @param[out]   probs         numClasses class scores, 0 below threshold.
+         **/
+        void DecodeCandidate(const object_detection::Candidate& cand,
+                             int imageWidth,
+                             int imageHeight,
+                             image::Box& box,
+                             float* probs);
+
+        /**
+         * @brief        Append a result for every class with a non-zero score.
+         * @param[in]    box           Detection box, centre and size.
+         * @param[in]    probs         numClasses class scores.
+         * @param[in]    imageWidth    Original image width.
+         * @param[in]    imageHeight   Original image height.
+         **/
+        void AddResults(const image::Box& box, const float* probs, int imageWidth, int imageHeight);
     };
 
 } /* namespace app */
@@ -16,12 +16,45 @@
  */
 #include "DetectorPostProcessing.hpp"
 #include "PlatformMath.hpp"
+#include <zephyr/logging/log.h>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+
+LOG_MODULE_REGISTER(DetectorPostProcessing);
 
 namespace arm {
 namespace app {
 
+    /**
+     * @brief       Convert a probability threshold to the raw int8 value that the
+     *              objectness output must exceed: sigmoid((q - zp) * scale) > t is
+     *              q > zp + logit(t) / scale.
+     * @param[in]   threshold   Probability threshold.
+     * @param[in]   scale       Output quantisation scale.
+     * @param[in]   zeroPoint   Output quantisation zero point.
+     * @return      Raw threshold, below INT8_MIN to accept all values.
+     **/
+    static int QuantisedLogitThreshold(float threshold, float scale, int zeroPoint)
+    {
+        constexpr int minThreshold = std::numeric_limits<int8_t>::min() - 1;
+        constexpr int maxThreshold = std::numeric_limits<int8_t>::max();
+
+        if (threshold <= 0.f) {
+            return minThreshold;
+        }
+        if (threshold >= 1.f) {
+            return maxThreshold;
+        }
+
+        const float logit = std::log(threshold / (1.f - threshold));
+        const float raw = std::floor(static_cast<float>(zeroPoint) + logit / scale);
+
+        return static_cast<int>(std::min(std::max(raw, static_cast<float>(minThreshold)),
+                                         static_cast<float>(maxThreshold)));
+    }
+
     DetectorPostProcess::DetectorPostProcess(
         TfLiteTensor* modelOutput0,
         TfLiteTensor* modelOutput1,
@@ -61,6 +94,15 @@ namespace app {
                                                        ->zero_point->data[0],
                                       .size = this->m_outputTensor1->bytes}},
         .topN = postProcessParams.topN};
+
+    for (auto& branch: this->m_net.branches) {
+        branch.objThreshold = QuantisedLogitThreshold(
+            postProcessParams.threshold, branch.scale, branch.zeroPoint);
+    }
+
+#if defined(CONFIG_OBJECT_DETECTION_INT8_POSTPROCESS)
+    this->m_probs.assign(ms_maxCandidates * this->m_net.numClasses, 0.f);
+#endif
     /* End init */
 }
 
@@ -70,6 +112,9 @@ bool DetectorPostProcess::DoPostProcess()
     int originalImageWidth  = m_postProcessParams.originalImageSize;
     int originalImageHeight = m_postProcessParams.originalImageSize;
 
+#if defined(CONFIG_OBJECT_DETECTION_INT8_POSTPROCESS)
+    DoPostProcessInt8(originalImageWidth, originalImageHeight);
+#else
     std::forward_list<image::Detection> detections;
     GetNetworkBoxes(this->m_net, originalImageWidth, originalImageHeight, m_postProcessParams.threshold, detections);
 
@@ -77,44 +122,192 @@ bool DetectorPostProcess::DoPostProcess()
     CalculateNMS(detections, this->m_net.numClasses, this->m_postProcessParams.nms);
 
     for (auto& it: detections) {
-        float xMin = it.bbox.x - it.bbox.w / 2.0f;
-        float xMax = it.bbox.x + it.bbox.w / 2.0f;
-        float yMin = it.bbox.y - it.bbox.h / 2.0f;
-        float yMax = it.bbox.y + it.bbox.h / 2.0f;
+        AddResults(it.bbox, it.prob.data(), originalImageWidth, originalImageHeight);
+    }
+#endif /* CONFIG_OBJECT_DETECTION_INT8_POSTPROCESS */
+    return true;
+}
 
-        if (xMin < 0) {
-            xMin = 0;
-        }
-        if (yMin < 0) {
-            yMin = 0;
-        }
-        if (xMax > originalImageWidth) {
-            xMax = originalImageWidth;
+void DetectorPostProcess::AddResults(const image::Box& box, const float* probs,
+                                     int imageWidth, int imageHeight)
+{
+    float xMin = box.x - box.w / 2.0f;
+    float xMax = box.x + box.w / 2.0f;
+    float yMin = box.y - box.h / 2.0f;
+    float yMax = box.y + box.h / 2.0f;
+
+    if (xMin < 0) {
+        xMin = 0;
+    }
+    if (yMin < 0) {
+        yMin = 0;
+    }
+    if (xMax > imageWidth) {
+        xMax = imageWidth;
+    }
+    if (yMax > imageHeight) {
+        yMax = imageHeight;
+    }
+
+    float boxX = xMin;
+    float boxY = yMin;
+    float boxWidth = xMax - xMin;
+    float boxHeight = yMax - yMin;
+
+    for (int j = 0; j < this->m_net.numClasses; ++j) {
+        if (probs[j] > 0) {
+
+            object_detection::DetectionResult tmpResult = {};
+            tmpResult.m_normalisedVal = probs[j];
+            tmpResult.m_x0 = boxX;
+            tmpResult.m_y0 = boxY;
+            tmpResult.m_w = boxWidth;
+            tmpResult.m_h = boxHeight;
+
+            this->m_results.push_back(tmpResult);
         }
-        if (yMax > originalImageHeight) {
-            yMax = originalImageHeight;
+    }
+}
+
+void DetectorPostProcess::DoPostProcessInt8(int imageWidth, int imageHeight)
+{
+    const int numClasses = this->m_net.numClasses;
+    const size_t capacity = this->m_net.topN > 0 ?
+        std::min(static_cast<size_t>(this->m_net.topN), ms_maxCandidates) : ms_maxCandidates;
+    size_t dropped = 0;
+    const size_t count = SelectCandidates(capacity, dropped);
+
+    /* A topN cap drops candidates on purpose, the Kconfig cap does not. */
+    if (dropped > 0 && this->m_net.topN <= 0) {
+        LOG_WRN_ONCE("%zu detection candidates dropped, only the best %zu are kept "
+                     "(CONFIG_OBJECT_DETECTION_MAX_CANDIDATES)", dropped, capacity);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        DecodeCandidate(this->m_candidates[i], imageWidth, imageHeight,
+                        this->m_boxes[i], &this->m_probs[i * numClasses]);
+        this->m_order[i] = static_cast<uint16_t>(i);
+    }
+
+    /* NMS per class on the flat arrays; m_order ends up sorted by the last class. */
+    for (int c = 0; c < numClasses; ++c) {
+        auto prob = [this, numClasses, c](uint16_t idx) -> float& {
+            return this->m_probs[idx * numClasses + c];
+        };
+
+        std::sort(this->m_order.begin(), this->m_order.begin() + count,
+                  [&prob](uint16_t a, uint16_t b) { return prob(a) > prob(b); });
+
+        for (size_t i = 0; i < count; ++i) {
+            const uint16_t a = this->m_order[i];
+            if (prob(a) == 0) {
+                continue;
+            }
+            for (size_t j = i + 1; j < count; ++j) {
+                const uint16_t b = this->m_order[j];
+                if (prob(b) == 0) {
+                    continue;
+                }
+                if (image::CalculateBoxIOU(this->m_boxes[a], this->m_boxes[b]) >
+                        this->m_postProcessParams.nms) {
+                    prob(b) = 0;
+                }
+            }
         }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint16_t idx = this->m_order[i];
+        AddResults(this->m_boxes[idx], &this->m_probs[idx * numClasses], imageWidth, imageHeight);
+    }
+}
 
-        float boxX = xMin;
-        float boxY = yMin;
-        float boxWidth = xMax - xMin;
-        float boxHeight = yMax - yMin;
+size_t DetectorPostProcess::SelectCandidates(size_t capacity, size_t& dropped)
+{
+    /* Min-heap on the logit so the weakest kept candidate is at the front. */
+    auto heapCompare = [](const object_detection::Candidate& a,
+                          const object_detection::Candidate& b) {
+        return a.logit > b.logit;
+    };
+    auto first = this->m_candidates.begin();
+    size_t count = 0;
+    dropped = 0;
+    const int stride = 5 + this->m_net.numClasses;
 
-        for (int j = 0; j < this->m_net.numClasses; ++j) {
-            if (it.prob[j] > 0) {
+    for (size_t i = 0; i < this->m_net.branches.size(); ++i) {
+        const object_detection::Branch& branch = this->m_net.branches[i];
+        const int numCells = branch.resolution * branch.resolution;
+        const int threshold = branch.objThreshold;
+        const int8_t* objectness = branch.modelOutput + 4;
 
-                object_detection::DetectionResult tmpResult = {};
-                tmpResult.m_normalisedVal = it.prob[j];
-                tmpResult.m_x0 = boxX;
-                tmpResult.m_y0 = boxY;
-                tmpResult.m_w = boxWidth;
-                tmpResult.m_h = boxHeight;
+        for (int cell = 0; cell < numCells; ++cell) {
+            for (int anc = 0; anc < branch.numBox; ++anc, objectness += stride) {
+                const int raw = *objectness;
+                if (raw <= threshold) {
+                    continue;
+                }
 
-                this->m_results.push_back(tmpResult);
+                const object_detection::Candidate cand{
+                    .logit  = static_cast<float>(raw - branch.zeroPoint) * branch.scale,
+                    .branch = static_cast<uint16_t>(i),
+                    .cell   = static_cast<uint16_t>(cell),
+                    .anchor = static_cast<uint16_t>(anc)};
+
+                if (count < capacity) {
+                    this->m_candidates[count++] = cand;
+                    std::push_heap(first, first + count, heapCompare);
+                    continue;
+                }
+
+                ++dropped;
+                if (cand.logit >= this->m_candidates[0].logit) {
+                    /* Ties replace the weakest, as the list-based path does. */
+                    std::pop_heap(first, first + count, heapCompare);
+                    this->m_candidates[count - 1] = cand;
+                    std::push_heap(first, first + count, heapCompare);
+                }
             }
         }
     }
-    return true;
+    return count;
+}
+
+void DetectorPostProcess::DecodeCandidate(const object_detection::Candidate& cand,
+                                          int imageWidth,
+                                          int imageHeight,
+                                          image::Box& box,
+                                          float* probs)
+{
+    const object_detection::Branch& branch = this->m_net.branches[cand.branch];
+    const int numClasses = this->m_net.numClasses;
+    const int resolution = branch.resolution;
+    const int h = cand.cell / resolution;
+    const int w = cand.cell % resolution;
+    const int8_t* out = branch.modelOutput +
+        (cand.cell * branch.numBox + cand.anchor) * (5 + numClasses);
+
+    auto dequantise = [&branch](int8_t value) {
+        return (static_cast<float>(value) - branch.zeroPoint) * branch.scale;
+    };
+
+    const float objectness = math::MathUtils::SigmoidF32(cand.logit);
+
+    /* Eliminate grid sensitivity trick involved in YOLOv4 */
+    box.x = (math::MathUtils::SigmoidF32(dequantise(out[0])) + w) / resolution;
+    box.y = (math::MathUtils::SigmoidF32(dequantise(out[1])) + h) / resolution;
+    box.w = std::exp(dequantise(out[2])) * branch.anchor[cand.anchor * 2] / this->m_net.inputWidth;
+    box.h = std::exp(dequantise(out[3])) * branch.anchor[cand.anchor * 2 + 1] / this->m_net.inputHeight;
+
+    /* Correct_YOLO_boxes */
+    box.x *= imageWidth;
+    box.w *= imageWidth;
+    box.y *= imageHeight;
+    box.h *= imageHeight;
+
+    for (int s = 0; s < numClasses; ++s) {
+        const float sig = math::MathUtils::SigmoidF32(dequantise(out[5 + s])) * objectness;
+        probs[s] = (sig > this->m_postProcessParams.threshold) ? sig : 0;
+    }
 }
 
 void DetectorPostProcess::InsertTopNDetections(std::forward_list<image::Detection>& detections, image::Detection& det)
@@ -0,0 +1,96 @@
+/* Copyright (C) Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https: //alifsemi.com/license
+ *
+ */
+
+#ifndef FUSED_PIPELINE_H_
+#define FUSED_PIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aipl_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest supported output width in pixels. */
+#define FUSED_PIPELINE_MAX_WIDTH 800
+
+/*
+ * Single-pass camera pre-processing from a RAW10 Bayer frame (16-bit
+ * little-endian words) to packed RGB888, replacing the separate RAW10->RAW8,
+ * crop, demosaic, resize, color correction and gamma passes.
+ *
+ * The result follows the separate passes: every output pixel is the bilinear
+ * resize sample (centre aligned, 8-bit weights) of the bilinearly demosaiced
+ * crop window, so only the four crop pixels around it are demosaiced. The
+ * optional color correction matrix (Q12) and gamma LUT follow, and the
+ * grayscale model input uses the weights of RgbToGrayscale().
+ */
+struct fused_pipeline_config {
+	/* Sensor frame size in pixels. */
+	uint16_t src_width;
+	uint16_t src_height;
+	/* Crop window inside the sensor frame; all values must be even. */
+	uint16_t crop_x;
+	uint16_t crop_y;
+	uint16_t crop_width;
+	uint16_t crop_height;
+	/* Output size; no larger than the crop window. */
+	uint16_t dst_width;
+	uint16_t dst_height;
+	aipl_bayer_filter_t bayer_format;
+	/* Optional 3x3 matrix, same layout as aipl_color_correction_rgb(). */
+	const float *ccm;
+	/* Optional 256-entry LUT applied after color correction. */
+	const uint8_t *gamma_lut;
+};
+
+struct fused_pipeline {
+	struct fused_pipeline_config cfg;
+	/* Q12 color matrix. */
+	int32_t matrix[9];
+	/* Channel (0 R, 1 G, 2 B) sampled at quad position row * 2 + col. */
+	uint8_t color[4];
+	/* Left crop column and its 8-bit resize weight for each output column. */
+	uint16_t col_x0[FUSED_PIPELINE_MAX_WIDTH];
+	uint8_t col_fx[FUSED_PIPELINE_MAX_WIDTH];
+};
+
+/**
+ * @brief Precompute the sampling tables and fixed-point matrix.
+ *
+ * @param p Pipeline state to initialise.
+ * @param cfg Geometry and optional stages.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the geometry is not supported.
+ */
+int fused_pipeline_init(struct fused_pipeline *p, const struct fused_pipeline_config *cfg);
+
+/**
+ * @brief Convert one RAW10 frame.
+ *
+ * @param p Initialised pipeline.
+ * @param raw10 Sensor frame, src_width * src_height 16-bit words.
+ * @param rgb Packed RGB888 output, dst_width * dst_height * 3 bytes.
+ * @param gray Optional grayscale output for the model input tensor,
+ *        dst_width * dst_height bytes, or NULL.
+ * @param gray_signed Store the grayscale output as int8 (value - 128).
+ */
+void fused_pipeline_run(const struct fused_pipeline *p, const uint8_t *raw10, uint8_t *rgb,
+			uint8_t *gray, bool gray_signed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FUSED_PIPELINE_H_ */
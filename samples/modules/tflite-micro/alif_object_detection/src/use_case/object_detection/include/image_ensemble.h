@@ -11,6 +11,8 @@
 #ifndef IMAGE_ENSEMBLE_H
 #define IMAGE_ENSEMBLE_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -20,6 +22,13 @@ extern "C" {
 int image_init(int output_width, int output_height);
 int get_image_data(uint8_t **output_image_data);
 
+/*
+ * Ask get_image_data() to also write the grayscale model input directly.
+ * Returns 0 if the capture pipeline will fill the tensor on every frame,
+ * -ENOTSUP if the caller has to run its own pre-processing.
+ */
+int image_set_model_input(uint8_t *tensor, size_t size, bool is_signed);
+
 #ifdef __cplusplus
 }
 #endif
@@ -192,6 +192,10 @@ namespace app {
         DetectorPostProcess postProcess =
             DetectorPostProcess(outputTensor0, outputTensor1, results, postProcessParams);
 
+        /* Let the capture pipeline write the model input directly when it can. */
+        const bool inputFromCamera = image_set_model_input(
+            inputTensor->data.uint8, inputTensor->bytes, model.IsDataSigned()) == 0;
+
         uint8_t* imageDataPtr = nullptr;
         if(get_image_data(&imageDataPtr) < 0) {
             LOG_ERR("Couldn't get image data");
@@ -216,7 +220,7 @@ namespace app {
         const size_t copySz = inputTensor->bytes;
 
         /* Run the pre-processing, inference and post-processing. */
-        if (!preProcess.DoPreProcess(imageDataPtr, copySz)) {
+        if (!inputFromCamera && !preProcess.DoPreProcess(imageDataPtr, copySz)) {
             LOG_ERR("Pre-processing failed.");
             return false;
         }
@@ -0,0 +1,205 @@
+/* Copyright (C) Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https: //alifsemi.com/license
+ *
+ */
+
+#include "fused_pipeline.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#define RAW10_MASK   0x03FFu
+#define MATRIX_SHIFT 12
+
+/* RAW10 -> RAW8 as raw10_gray16le_bytes_to_raw8_inplace_mve(): round(v * 255 / 1023) */
+#define RAW8_SCALE 16336u
+
+enum {
+	FUSED_R,
+	FUSED_G,
+	FUSED_B,
+};
+
+/* Bayer pattern of each format, quad positions row * 2 + col */
+static const uint8_t bayer_colors[][4] = {
+	[AIPL_BAYER_RGGB] = {FUSED_R, FUSED_G, FUSED_G, FUSED_B},
+	[AIPL_BAYER_GRBG] = {FUSED_G, FUSED_R, FUSED_B, FUSED_G},
+	[AIPL_BAYER_GBRG] = {FUSED_G, FUSED_B, FUSED_R, FUSED_G},
+	[AIPL_BAYER_BGGR] = {FUSED_B, FUSED_G, FUSED_G, FUSED_R},
+};
+
+/*
+ * Centre-aligned source position of output pixel @p i in Q16, clamped to the
+ * image like the bilinear aipl_resize().
+ */
+static uint32_t resize_pos(uint32_t i, uint32_t src, uint32_t dst)
+{
+	const uint32_t step = (src << 16) / dst;
+	const int32_t pos = (int32_t)(step * i + step / 2) - 0x8000;
+
+	if (pos < 0) {
+		return 0;
+	}
+	return MIN((uint32_t)pos, (src - 1) << 16);
+}
+
+int fused_pipeline_init(struct fused_pipeline *p, const struct fused_pipeline_config *cfg)
+{
+	static const float identity[9] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+	const float *ccm = cfg->ccm ? cfg->ccm : identity;
+
+	if ((cfg->crop_x | cfg->crop_y | cfg->crop_width | cfg->crop_height) & 1) {
+		return -EINVAL;
+	}
+	if (cfg->crop_width < 2 || cfg->crop_height < 2 ||
+	    cfg->crop_x + cfg->crop_width > cfg->src_width ||
+	    cfg->crop_y + cfg->crop_height > cfg->src_height) {
+		return -EINVAL;
+	}
+	if (cfg->dst_width == 0 || cfg->dst_height == 0 ||
+	    cfg->dst_width > FUSED_PIPELINE_MAX_WIDTH ||
+	    cfg->dst_width > cfg->crop_width || cfg->dst_height > cfg->crop_height) {
+		return -EINVAL;
+	}
+	if ((unsigned int)cfg->bayer_format >= ARRAY_SIZE(bayer_colors) ||
+	    bayer_colors[cfg->bayer_format][0] == bayer_colors[cfg->bayer_format][1]) {
+		return -EINVAL;
+	}
+
+	p->cfg = *cfg;
+	memcpy(p->color, bayer_colors[cfg->bayer_format], sizeof(p->color));
+
+	for (int i = 0; i < 9; i++) {
+		p->matrix[i] = (int32_t)lroundf(ccm[i] * (1 << MATRIX_SHIFT));
+	}
+
+	for (uint32_t x = 0; x < cfg->dst_width; x++) {
+		uint32_t pos = resize_pos(x, cfg->crop_width, cfg->dst_width);
+
+		p->col_x0[x] = pos >> 16;
+		p->col_fx[x] = (pos >> 8) & 0xff;
+	}
+
+	return 0;
+}
+
+static inline uint8_t fused_clamp(int32_t v)
+{
+	return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v);
+}
+
+/* Crop window access with the edges mirrored, so neighbours keep their Bayer color */
+struct crop_view {
+	const uint16_t *base;
+	uint32_t pitch;
+	int32_t width;
+	int32_t height;
+};
+
+static inline int32_t mirror(int32_t i, int32_t n)
+{
+	if (i < 0) {
+		return -i;
+	}
+	return i >= n ? 2 * n - 2 - i : i;
+}
+
+static inline uint32_t raw8(const struct crop_view *v, int32_t x, int32_t y)
+{
+	uint32_t v10 = v->base[mirror(y, v->height) * v->pitch + mirror(x, v->width)] & RAW10_MASK;
+
+	return (v10 * RAW8_SCALE + (1u << 15)) >> 16;
+}
+
+/* Bilinear demosaic of one crop pixel */
+static void demosaic(const struct fused_pipeline *p, const struct crop_view *v, int32_t x,
+		     int32_t y, uint32_t rgb[3])
+{
+	const uint8_t c = p->color[(y & 1) * 2 + (x & 1)];
+	const uint32_t here = raw8(v, x, y);
+	const uint32_t cross = (raw8(v, x - 1, y) + raw8(v, x + 1, y) + raw8(v, x, y - 1) +
+				raw8(v, x, y + 1) + 2) >> 2;
+
+	if (c != FUSED_G) {
+		const uint32_t diag = (raw8(v, x - 1, y - 1) + raw8(v, x + 1, y - 1) +
+				       raw8(v, x - 1, y + 1) + raw8(v, x + 1, y + 1) + 2) >> 2;
+
+		rgb[c] = here;
+		rgb[FUSED_G] = cross;
+		rgb[2 - c] = diag;
+		return;
+	}
+
+	/* Green site: the horizontal neighbours carry the color of this row */
+	const uint8_t row_c = p->color[(y & 1) * 2 + ((x + 1) & 1)];
+
+	rgb[FUSED_G] = here;
+	rgb[row_c] = (raw8(v, x - 1, y) + raw8(v, x + 1, y) + 1) >> 1;
+	rgb[2 - row_c] = (raw8(v, x, y - 1) + raw8(v, x, y + 1) + 1) >> 1;
+}
+
+void fused_pipeline_run(const struct fused_pipeline *p, const uint8_t *raw10, uint8_t *rgb,
+			uint8_t *gray, bool gray_signed)
+{
+	const struct fused_pipeline_config *cfg = &p->cfg;
+	const struct crop_view v = {
+		.base = (const uint16_t *)raw10 + cfg->crop_y * cfg->src_width + cfg->crop_x,
+		.pitch = cfg->src_width,
+		.width = cfg->crop_width,
+		.height = cfg->crop_height,
+	};
+	const int32_t rnd = 1 << (MATRIX_SHIFT - 1);
+	const int32_t *m = p->matrix;
+
+	for (uint32_t y = 0; y < cfg->dst_height; y++) {
+		const uint32_t py = resize_pos(y, cfg->crop_height, cfg->dst_height);
+		const int32_t y0 = py >> 16;
+		const int32_t y1 = MIN(y0 + 1, v.height - 1);
+		const uint32_t fy = (py >> 8) & 0xff;
+
+		for (uint32_t x = 0; x < cfg->dst_width; x++) {
+			const int32_t x0 = p->col_x0[x];
+			const int32_t x1 = MIN(x0 + 1, v.width - 1);
+			const uint32_t fx = p->col_fx[x];
+			uint32_t tl[3], tr[3], bl[3], br[3];
+			int32_t s[3];
+			uint8_t *out = rgb + (y * cfg->dst_width + x) * 3;
+
+			demosaic(p, &v, x0, y0, tl);
+			demosaic(p, &v, x1, y0, tr);
+			demosaic(p, &v, x0, y1, bl);
+			demosaic(p, &v, x1, y1, br);
+
+			for (int c = 0; c < 3; c++) {
+				const uint32_t top = tl[c] * (256 - fx) + tr[c] * fx;
+				const uint32_t bot = bl[c] * (256 - fx) + br[c] * fx;
+
+				s[c] = (top * (256 - fy) + bot * fy + 0x8000) >> 16;
+			}
+
+			for (int c = 0; c < 3; c++) {
+				uint8_t val = fused_clamp(
+					(m[3 * c] * s[0] + m[3 * c + 1] * s[1] + m[3 * c + 2] * s[2] +
+					 rnd) >> MATRIX_SHIFT);
+
+				out[c] = cfg->gamma_lut ? cfg->gamma_lut[val] : val;
+			}
+
+			if (gray) {
+				/* Same float weights and truncation as RgbToGrayscale() */
+				uint32_t g = (uint32_t)(0.299f * out[0] + 0.587f * out[1] +
+							0.114f * out[2]);
+				uint8_t luma = MIN(g, 255u);
+
+				gray[y * cfg->dst_width + x] = gray_signed ? (luma ^ 0x80) : luma;
+			}
+		}
+	}
+}
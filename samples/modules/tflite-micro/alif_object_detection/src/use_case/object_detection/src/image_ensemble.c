@@ -12,6 +12,8 @@
 
 #include "image_ensemble.h"
 #include "image_processing.h"
+#include "fused_pipeline.h"
+#include "camera_capture/camera_capture.h"
 
 #include <aipl_demosaic.h>
 #include <aipl_resize.h>
@@ -55,8 +57,12 @@ LOG_MODULE_REGISTER(image_ensemble, LOG_LEVEL_INF);
 #endif
 #endif
 
-static const struct device *video_dev;
-struct video_buffer *buffers[VIDEO_BUFFER_COUNT], *vbuf;
+/*
+ * Sensor RAW10 straight to the display image and model input in one pass.
+ * Exposure statistics are only gathered by the separate RAW10->RAW8 pass.
+ */
+#define FUSED_PREPROCESS (IS_ENABLED(CONFIG_OBJECT_DETECTION_FUSED_PREPROCESS) && \
+			  !ISP_ENABLED && !CIMAGE_EXPOSURE_CALC)
 
 /* Output dimensions, set during image_init() */
 static int output_width;
@@ -73,6 +79,40 @@ static uint8_t image_data[CIMAGE_RGB_WIDTH_MAX * CIMAGE_RGB_HEIGHT_MAX * RGB_BYT
 	__section("SRAM0.camera_frame_bayer_to_rgb_buf");
 #endif
 
+#if FUSED_PREPROCESS
+static struct fused_pipeline fused;
+
+/* Model input tensor filled alongside image_data, set by image_set_model_input() */
+static uint8_t *model_input;
+static bool model_input_signed;
+
+static int fused_init(void)
+{
+	const struct fused_pipeline_config cfg = {
+		.src_width = CIMAGE_X,
+		.src_height = CIMAGE_Y,
+		.crop_x = (CIMAGE_X - CIMAGE_RGB_WIDTH_MAX) / 2,
+		.crop_y = (CIMAGE_Y - CIMAGE_RGB_HEIGHT_MAX) / 2,
+		.crop_width = CIMAGE_RGB_WIDTH_MAX,
+		.crop_height = CIMAGE_RGB_HEIGHT_MAX,
+		.dst_width = output_width,
+		.dst_height = output_height,
+		.bayer_format = CAM_BAYER_FORMAT,
+#if CIMAGE_COLOR_CORRECTION
+		.ccm = camera_get_color_correction_matrix(),
+		.gamma_lut = camera_get_gamma_lut(),
+#endif
+	};
+	int ret = fused_pipeline_init(&fused, &cfg);
+
+	if (ret) {
+		LOG_ERR("Fused pre-processing does not support %dx%d output", output_width,
+			output_height);
+	}
+	return ret;
+}
+#endif
+
 void aipl_cpu_cache_clean(const void *ptr, uint32_t size)
 {
 	sys_cache_data_flush_range((void *)ptr, size);
@@ -83,219 +123,96 @@ void aipl_cpu_cache_invalidate(const void *ptr, uint32_t size)
 	sys_cache_data_invd_range((void *)ptr, size);
 }
 
-static int fourcc_to_pitch(uint32_t fourcc, uint32_t width)
-{
-	int pitch;
-
-	switch (fourcc) {
-	case VIDEO_PIX_FMT_RGB888_PLANAR_PRIVATE:
-	case VIDEO_PIX_FMT_NV24:
-	case VIDEO_PIX_FMT_NV42:
-		pitch = width * 3;
-		break;
-	case VIDEO_PIX_FMT_RGB565:
-	case VIDEO_PIX_FMT_Y10P:
-	case VIDEO_PIX_FMT_BGGR10:
-	case VIDEO_PIX_FMT_GBRG10:
-	case VIDEO_PIX_FMT_GRBG10:
-	case VIDEO_PIX_FMT_RGGB10:
-	case VIDEO_PIX_FMT_BGGR12:
-	case VIDEO_PIX_FMT_GBRG12:
-	case VIDEO_PIX_FMT_GRBG12:
-	case VIDEO_PIX_FMT_RGGB12:
-	case VIDEO_PIX_FMT_BGGR14:
-	case VIDEO_PIX_FMT_GBRG14:
-	case VIDEO_PIX_FMT_GRBG14:
-	case VIDEO_PIX_FMT_RGGB14:
-	case VIDEO_PIX_FMT_BGGR16:
-	case VIDEO_PIX_FMT_GBRG16:
-	case VIDEO_PIX_FMT_GRBG16:
-	case VIDEO_PIX_FMT_RGGB16:
-	case VIDEO_PIX_FMT_Y10:
-	case VIDEO_PIX_FMT_Y12:
-	case VIDEO_PIX_FMT_Y14:
-	case VIDEO_PIX_FMT_YUYV:
-	case VIDEO_PIX_FMT_YVYU:
-	case VIDEO_PIX_FMT_VYUY:
-	case VIDEO_PIX_FMT_UYVY:
-	case VIDEO_PIX_FMT_NV16:
-	case VIDEO_PIX_FMT_NV61:
-	case VIDEO_PIX_FMT_YUV422P:
-		pitch = width << 1;
-		break;
-	case VIDEO_PIX_FMT_NV12:
-	case VIDEO_PIX_FMT_NV21:
-	case VIDEO_PIX_FMT_YUV420:
-	case VIDEO_PIX_FMT_YVU420:
-		pitch = (width * 3) >> 1;
-		break;
-	case VIDEO_PIX_FMT_BGGR8:
-	case VIDEO_PIX_FMT_GBRG8:
-	case VIDEO_PIX_FMT_GRBG8:
-	case VIDEO_PIX_FMT_RGGB8:
-	case VIDEO_PIX_FMT_GREY:
-	default:
-		pitch = width;
-		break;
-	}
-
-	return pitch;
-}
-
 int image_init(int req_output_width, int req_output_height)
 {
-	struct video_format fmt = { 0 };
-	struct video_caps caps;
-	size_t bsize;
-	int i = 0;
 	int ret;
 
 	output_width = req_output_width;
 	output_height = req_output_height;
 
-	enum video_endpoint_id ep = VIDEO_EP_OUT;
-
-	#if ISP_ENABLED
-	video_dev = DEVICE_DT_GET_ONE(vsi_isp_pico);
-	ep = VIDEO_EP_IN;
-	#else
-	video_dev = DEVICE_DT_GET_ONE(alif_cam);
-	#endif
-	if (!device_is_ready(video_dev)) {
-		LOG_ERR("%s: device not ready.", video_dev->name);
+#if FUSED_PREPROCESS
+	if (fused_init()) {
 		return -1;
 	}
-	LOG_INF("- Device name: %s\n", video_dev->name);
+#endif
 
-	/* Get capabilities */
-	if (video_get_caps(video_dev, ep, &caps)) {
-		LOG_ERR("Unable to retrieve video capabilities");
-		return -1;
-	}
+	/* Only the newest frame is processed; older ones go straight back to the camera */
+	const struct camera_capture_config cfg = {
+		.pixelformat = VIDEO_PIX_FMT_Y10P,
+#if ISP_ENABLED
+		/* ISP scales from sensor resolution to the requested capture size */
+		.out_pixelformat = OUTPUT_FORMAT,
+		.out_width = output_width,
+		.out_height = output_height,
+#endif
+		.num_buffers = VIDEO_BUFFER_COUNT,
+		.mode = CAMERA_CAPTURE_LATEST,
+	};
+#if ISP_ENABLED
+	const struct device *video_dev = DEVICE_DT_GET_ONE(vsi_isp_pico);
+#else
+	const struct device *video_dev = DEVICE_DT_GET_ONE(alif_cam);
+#endif
 
-	LOG_INF("- Capabilities:\n");
-	while (caps.format_caps[i].pixelformat) {
-		const struct video_format_cap *fcap = &caps.format_caps[i];
-		/* fourcc to string */
-		LOG_INF("  %c%c%c%c width (min, max, step)[%u; %u; %u] "
-			"height (min, max, step)[%u; %u; %u]\n",
-		       (char)fcap->pixelformat,
-		       (char)(fcap->pixelformat >> 8),
-		       (char)(fcap->pixelformat >> 16),
-		       (char)(fcap->pixelformat >> 24),
-		       fcap->width_min, fcap->width_max, fcap->width_step,
-		       fcap->height_min, fcap->height_max, fcap->height_step);
-
-		if (fcap->pixelformat == VIDEO_PIX_FMT_Y10P) {
-			fmt.pixelformat = VIDEO_PIX_FMT_Y10P;
-			fmt.width = fcap->width_min;
-			fmt.height = fcap->height_min;
-		}
-		i++;
-	}
+	LOG_INF("- Device name: %s\n", video_dev->name);
 
-	if (fmt.pixelformat == 0) {
-		LOG_ERR("Desired Pixel format is not supported.");
+	ret = camera_capture_init(video_dev, &cfg);
+	if (ret) {
+		LOG_ERR("Camera capture init failed. ret - %d", ret);
 		return -1;
 	}
 
-    fmt.pitch = fourcc_to_pitch(fmt.pixelformat, fmt.width);
-
-	ret = video_set_format(video_dev, ep, &fmt);
+	ret = camera_capture_start();
 	if (ret) {
-		LOG_ERR("Failed to set video format. ret - %d", ret);
 		return -1;
 	}
 
-	LOG_INF("- pipeline format: %c%c%c%c %ux%u\n", (char)fmt.pixelformat,
-	       (char)(fmt.pixelformat >> 8),
-	       (char)(fmt.pixelformat >> 16),
-	       (char)(fmt.pixelformat >> 24),
-	       fmt.width, fmt.height);
-
-	#if (ISP_ENABLED)
-		/*
-		 * Set Output Endpoint format. ISP scales from sensor
-		 * resolution to the requested capture size.
-		 */
-		fmt.width = output_width;
-		fmt.height = output_height;
-		fmt.pixelformat = OUTPUT_FORMAT;
-		fmt.pitch = fourcc_to_pitch(fmt.pixelformat, fmt.width);
-
-		LOG_INF("- output format: %c%c%c%c %ux%u\n", (char)fmt.pixelformat,
-		(char)(fmt.pixelformat >> 8),
-		(char)(fmt.pixelformat >> 16),
-		(char)(fmt.pixelformat >> 24),
-		fmt.width, fmt.height);
-
-		ret = video_set_format(video_dev, VIDEO_EP_OUT, &fmt);
-		if (ret) {
-			LOG_ERR("Failed to set video output format. ret - %d", ret);
-			return -1;
-		}
-	#endif
-
-	/* Size to allocate for each buffer */
-	bsize = fmt.pitch * fmt.height;
-
-	LOG_INF("Width - %d, Pitch - %d, Height - %d, Buff size - %d\n",
-		fmt.width, fmt.pitch, fmt.height, bsize);
-
-	for (int j = 0; j < ARRAY_SIZE(buffers); j++) {
-		buffers[j] = video_buffer_alloc(bsize, K_NO_WAIT);
-		if (buffers[j] == NULL) {
-			LOG_ERR("Unable to alloc video buffer");
-			return -1;
-		}
-
-		/* Allocated Buffer Information */
-		LOG_INF("- addr - 0x%x, size - %d, bytesused - %d\n",
-			(uint32_t)buffers[j]->buffer,
-			bsize,
-			buffers[j]->bytesused);
-
-		video_enqueue(video_dev, VIDEO_EP_OUT, buffers[j]);
-	}
+	return 0;
+}
 
-	/* Start streaming */
-	ret = video_stream_start(video_dev);
-	if (ret) {
-		LOG_ERR("Unable to start capture (interface). ret - %d", ret);
-		return -1;
+int image_set_model_input(uint8_t *tensor, size_t size, bool is_signed)
+{
+#if FUSED_PREPROCESS
+	if (size != (size_t)output_width * output_height) {
+		model_input = NULL;
+		return -ENOTSUP;
 	}
 
-	LOG_INF("Capture started\n");
-
+	model_input = tensor;
+	model_input_signed = is_signed;
 	return 0;
+#else
+	ARG_UNUSED(tensor);
+	ARG_UNUSED(size);
+	ARG_UNUSED(is_signed);
+	return -ENOTSUP;
+#endif
 }
 
 int get_image_data(uint8_t **output_image_data)
 {
-	int ret;
 	aipl_error_t aipl_ret;
+	struct camera_frame *frame = camera_capture_get(K_FOREVER);
 
-	ret = video_dequeue(video_dev, VIDEO_EP_OUT, &vbuf, K_FOREVER);
-	if (ret) {
-		LOG_ERR("Unable to dequeue video buf");
+	if (!frame) {
+		LOG_ERR("Unable to get camera frame");
 		return -1;
 	}
 
-	/*
-	 * Drain any stale frames that accumulated while the previous frame was
-	 * being processed (inference + display).  Re-enqueue them immediately so
-	 * the ISP has empty buffers to write into and does not stall.  Keep only
-	 * the newest (last) dequeued buffer for actual processing.
-	 */
-	struct video_buffer *newer;
-	while (video_dequeue(video_dev, VIDEO_EP_OUT, &newer, K_NO_WAIT) == 0) {
-		video_enqueue(video_dev, VIDEO_EP_OUT, vbuf);
-		vbuf = newer;
+	uint8_t *raw_image = frame->data;
+
+	#if FUSED_PREPROCESS
+	/* Crop, demosaic, resize, color correction and gamma in one pass */
+	fused_pipeline_run(&fused, raw_image, image_data, model_input, model_input_signed);
+	#elif !ISP_ENABLED
+	/* The frame is converted in place, which is only allowed for its sole holder */
+	raw_image = camera_frame_writable(frame);
+	if (!raw_image) {
+		LOG_ERR("Camera frame is shared, can't convert it in place");
+		camera_frame_unref(frame);
+		return -1;
 	}
 
-	uint8_t *raw_image = vbuf->buffer;
-
-	#if !ISP_ENABLED
 	/* in place conversion of RAW10 to RAW8 (scaling) */
 	/* When CIMAGE_EXPOSURE_CALC is enabled, exposure statistics are computed during conversion */
 	raw10_gray16le_bytes_to_raw8_inplace_mve(raw_image, (CIMAGE_X * CIMAGE_Y));
@@ -327,6 +244,7 @@ int get_image_data(uint8_t **output_image_data)
 
 	if (aipl_ret != AIPL_ERR_OK) {
 		LOG_ERR("Demosaic failed with error code %d", aipl_ret);
+		camera_frame_unref(frame);
 		return -1;
 	}
 	#else
@@ -338,19 +256,10 @@ int get_image_data(uint8_t **output_image_data)
 				output_width, output_height);
 	#endif
 
-	ret = video_enqueue(video_dev, VIDEO_EP_OUT, vbuf);
-	if (ret) {
-		LOG_ERR("Unable to requeue video buf");
-		return -1;
-	}
-
-	ret = video_stream_start(video_dev);
-	if (ret && ret != -EBUSY) {
-		LOG_ERR("Unable to start capture (interface). ret - %d", ret);
-		return -1;
-	}
+	/* The camera buffer is no longer needed, let the next frame land in it */
+	camera_frame_unref(frame);
 
-#if !ISP_ENABLED
+#if !ISP_ENABLED && !FUSED_PREPROCESS
 	/* Image resizing from sensor resolution to requested output size */
 	if (output_width > CIMAGE_RGB_WIDTH_MAX ||
 	    output_height > CIMAGE_RGB_HEIGHT_MAX) {
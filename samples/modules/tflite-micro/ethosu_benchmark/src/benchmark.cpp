@@ -0,0 +1,168 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "benchmark.hpp"
+
+#ifdef CONFIG_ETHOSU_BENCHMARK_NPU_STUB
+#include "ethosu_stub_op.hpp"
+#endif
+
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include <algorithm>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_ARCH_POSIX
+/* Built into the native_sim runner, see host_clock.c */
+extern "C" uint64_t ethosu_benchmark_host_clock_ns(void);
+#endif
+
+namespace EthosuBenchmark
+{
+namespace
+{
+/*
+ * Simulated time does not advance while native_sim computes, so host builds
+ * time with the host monotonic clock instead of the cycle counter.
+ */
+uint64_t timestamp(void)
+{
+#ifdef CONFIG_ARCH_POSIX
+	return ethosu_benchmark_host_clock_ns();
+#else
+	return k_cycle_get_32();
+#endif
+}
+
+uint32_t elapsedUs(uint64_t start)
+{
+#ifdef CONFIG_ARCH_POSIX
+	return static_cast<uint32_t>((ethosu_benchmark_host_clock_ns() - start) / 1000);
+#else
+	return k_cyc_to_us_floor32(k_cycle_get_32() - static_cast<uint32_t>(start));
+#endif
+}
+
+bool outputMatches(tflite::MicroInterpreter &interpreter, const Model &model)
+{
+	if (model.expectedOutput == nullptr || interpreter.outputs_size() == 0) {
+		return true;
+	}
+
+	const TfLiteTensor *output = interpreter.output(0);
+
+	return output->bytes == model.expectedOutputSize &&
+	       memcmp(output->data.uint8, model.expectedOutput, output->bytes) == 0;
+}
+} /* namespace */
+
+Result Run(const Model &model, uint8_t *arena, size_t arenaSize, uint32_t iterations)
+{
+	Result result = {};
+
+	result.model = model.name;
+	result.arenaSize = arenaSize;
+	result.status = Status::SetupFailed;
+
+	uint64_t start = timestamp();
+
+	const tflite::Model *tflModel = ::tflite::GetModel(model.networkModel);
+	if (tflModel->version() != TFLITE_SCHEMA_VERSION) {
+		printk("%s: model schema version unsupported: version=%u, supported=%d\n",
+		       model.name, static_cast<unsigned>(tflModel->version()),
+		       TFLITE_SCHEMA_VERSION);
+		return result;
+	}
+
+	tflite::MicroMutableOpResolver<1> resolver;
+#ifdef CONFIG_ETHOSU_BENCHMARK_NPU_STUB
+	resolver.AddCustom(EthosUOpName, StubEthosURegistration());
+#else
+	resolver.AddEthosU();
+#endif
+
+	tflite::MicroInterpreter interpreter(tflModel, resolver, arena, arenaSize);
+
+	if (interpreter.AllocateTensors() != kTfLiteOk) {
+		printk("%s: AllocateTensors failed, arena=%zu\n", model.name, arenaSize);
+		return result;
+	}
+
+	TfLiteTensor *input = interpreter.input(0);
+	if (input->bytes != model.inputSize) {
+		printk("%s: input size mismatch: input=%zu, network=%zu\n", model.name,
+		       model.inputSize, input->bytes);
+		return result;
+	}
+
+	memcpy(input->data.uint8, model.input, model.inputSize);
+	result.setupUs = elapsedUs(start);
+
+	uint64_t warmSumUs = 0;
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		start = timestamp();
+
+		if (interpreter.Invoke() != kTfLiteOk) {
+			printk("%s: Invoke failed at iteration %u\n", model.name, i);
+			result.status = Status::InvokeFailed;
+			return result;
+		}
+
+		const uint32_t us = elapsedUs(start);
+
+		result.iterations++;
+
+		if (i == 0) {
+			result.coldUs = us;
+			continue;
+		}
+
+		if (i == 1 || us < result.warmMinUs) {
+			result.warmMinUs = us;
+		}
+		result.warmMaxUs = std::max(result.warmMaxUs, us);
+		warmSumUs += us;
+	}
+
+	if (result.iterations > 1) {
+		const uint32_t warmCount = result.iterations - 1;
+
+		result.warmAvgUs = static_cast<uint32_t>(warmSumUs / warmCount);
+		if (warmSumUs > 0) {
+			result.throughputX100 =
+				static_cast<uint32_t>((100000000ULL * warmCount) / warmSumUs);
+		}
+	}
+
+	result.arenaUsed = interpreter.arena_used_bytes();
+	result.status = outputMatches(interpreter, model) ? Status::Ok : Status::OutputMismatch;
+
+	return result;
+}
+
+const char *StatusName(Status status)
+{
+	switch (status) {
+	case Status::Ok:
+		return "ok";
+	case Status::SetupFailed:
+		return "setup_failed";
+	case Status::InvokeFailed:
+		return "invoke_failed";
+	case Status::OutputMismatch:
+		return "output_mismatch";
+	}
+
+	return "unknown";
+}
+} /* namespace EthosuBenchmark */
@@ -0,0 +1,50 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "models.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EthosuBenchmark
+{
+enum class Status {
+	Ok,
+	SetupFailed,  /* Schema mismatch, AllocateTensors() or input size mismatch */
+	InvokeFailed,
+	OutputMismatch,
+};
+
+struct Result {
+	const char *model;
+	Status status;
+	uint32_t iterations;
+	uint32_t setupUs; /* GetModel() + interpreter construction + AllocateTensors() */
+	uint32_t coldUs;  /* First Invoke() after setup */
+	uint32_t warmMinUs;
+	uint32_t warmAvgUs;
+	uint32_t warmMaxUs;
+	/* Warm inferences per second, times 100 to keep two decimals without float printing */
+	uint32_t throughputX100;
+	size_t arenaSize;
+	size_t arenaUsed;
+};
+
+/**
+ * @brief Run @p iterations inferences of @p model using @p arena.
+ *
+ * The interpreter is created once so only the first Invoke() pays for lazy initialization and
+ * cold caches; the remaining iterations are reported as warm.
+ */
+Result Run(const Model &model, uint8_t *arena, size_t arenaSize, uint32_t iterations);
+
+const char *StatusName(Status status);
+} /* namespace EthosuBenchmark */
@@ -0,0 +1,48 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/*
+ * No-op Ethos-U driver for host builds. Only the entry points used by the stub ethos-u
+ * operator in ethosu_stub_op.cpp are provided; command streams are accepted and completed
+ * immediately, so reported timings cover the CPU side of the interpreter only.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct ethosu_driver {
+	int reserved;
+};
+
+static struct ethosu_driver stub_driver;
+
+struct ethosu_driver *ethosu_reserve_driver(void)
+{
+	return &stub_driver;
+}
+
+void ethosu_release_driver(struct ethosu_driver *drv)
+{
+	(void)drv;
+}
+
+int ethosu_invoke_v3(struct ethosu_driver *drv, const void *custom_data_ptr,
+		     const int custom_data_size, uint64_t *const base_addr,
+		     const size_t *base_addr_size, const int num_base_addr, void *user_arg)
+{
+	(void)drv;
+	(void)custom_data_ptr;
+	(void)custom_data_size;
+	(void)base_addr;
+	(void)base_addr_size;
+	(void)num_base_addr;
+	(void)user_arg;
+
+	return 0;
+}
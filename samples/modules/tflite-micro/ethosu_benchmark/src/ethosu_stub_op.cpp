@@ -0,0 +1,85 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "ethosu_stub_op.hpp"
+
+#include <tensorflow/lite/micro/kernels/kernel_util.h>
+#include <tensorflow/lite/micro/memory_helpers.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+extern "C" {
+struct ethosu_driver;
+
+struct ethosu_driver *ethosu_reserve_driver(void);
+void ethosu_release_driver(struct ethosu_driver *drv);
+int ethosu_invoke_v3(struct ethosu_driver *drv, const void *custom_data_ptr,
+		     const int custom_data_size, uint64_t *const base_addr,
+		     const size_t *base_addr_size, const int num_base_addr, void *user_arg);
+}
+
+namespace EthosuBenchmark
+{
+namespace
+{
+/* Same limit as the real kernel: command stream input plus up to 8 base addresses */
+constexpr int MaxBaseAddr = 8;
+
+TfLiteStatus Eval(TfLiteContext *context, TfLiteNode *node)
+{
+	uint64_t baseAddr[MaxBaseAddr];
+	size_t baseAddrSize[MaxBaseAddr];
+	size_t cmsBytes;
+	int numBaseAddr = 0;
+
+	TF_LITE_ENSURE(context, node->inputs->size >= 1);
+
+	const TfLiteEvalTensor *cms = tflite::micro::GetEvalInput(context, node, 0);
+
+	TF_LITE_ENSURE_OK(context, tflite::TfLiteEvalTensorByteLength(cms, &cmsBytes));
+
+	/* Every tensor after the command stream, inputs first, is one base address */
+	const int numTensors = node->inputs->size - 1 + node->outputs->size;
+
+	TF_LITE_ENSURE(context, numTensors <= MaxBaseAddr);
+
+	for (int i = 1; i < node->inputs->size; i++) {
+		const TfLiteEvalTensor *tensor = tflite::micro::GetEvalInput(context, node, i);
+
+		TF_LITE_ENSURE_OK(context, tflite::TfLiteEvalTensorByteLength(
+						   tensor, &baseAddrSize[numBaseAddr]));
+		baseAddr[numBaseAddr++] = reinterpret_cast<uintptr_t>(tensor->data.raw);
+	}
+
+	for (int i = 0; i < node->outputs->size; i++) {
+		TfLiteEvalTensor *tensor = tflite::micro::GetEvalOutput(context, node, i);
+
+		TF_LITE_ENSURE_OK(context, tflite::TfLiteEvalTensorByteLength(
+						   tensor, &baseAddrSize[numBaseAddr]));
+		baseAddr[numBaseAddr++] = reinterpret_cast<uintptr_t>(tensor->data.raw);
+	}
+
+	struct ethosu_driver *drv = ethosu_reserve_driver();
+	const int ret = ethosu_invoke_v3(drv, cms->data.raw, static_cast<int>(cmsBytes), baseAddr,
+					 baseAddrSize, numBaseAddr, nullptr);
+
+	ethosu_release_driver(drv);
+
+	return ret == 0 ? kTfLiteOk : kTfLiteError;
+}
+} /* namespace */
+
+TFLMRegistration *StubEthosURegistration()
+{
+	static TFLMRegistration registration = tflite::micro::RegisterOp(nullptr, nullptr, Eval);
+
+	return &registration;
+}
+} /* namespace EthosuBenchmark */
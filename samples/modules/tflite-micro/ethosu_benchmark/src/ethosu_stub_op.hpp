@@ -0,0 +1,27 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include <tensorflow/lite/micro/micro_common.h>
+
+namespace EthosuBenchmark
+{
+/* Custom code Vela gives the operator wrapping an NPU command stream */
+constexpr const char *EthosUOpName = "ethos-u";
+
+/**
+ * @brief Registration of the ethos-u operator for host builds.
+ *
+ * With CONFIG_ARM_ETHOS_U=n TFLM compiles an empty ethos-u kernel and AddEthosU() registers
+ * nothing, so AllocateTensors() fails on every Vela model. This registration hands the command
+ * stream and tensor base addresses to the stub driver in ethosu_stub.c instead.
+ */
+TFLMRegistration *StubEthosURegistration();
+} /* namespace EthosuBenchmark */
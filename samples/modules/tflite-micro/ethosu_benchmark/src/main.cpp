@@ -0,0 +1,41 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "benchmark.hpp"
+#include "models.hpp"
+#include "report.hpp"
+
+#include <zephyr/kernel.h>
+
+using namespace EthosuBenchmark;
+
+int main()
+{
+	int failures = 0;
+
+	printk("Ethos-U benchmark: %zu model(s), %u iterations, npu=%s\n", modelCount,
+	       CONFIG_ETHOSU_BENCHMARK_ITERATIONS, ETHOSU_BENCHMARK_NPU);
+
+	ReportBegin();
+
+	for (size_t i = 0; i < modelCount; i++) {
+		const Result result = Run(models[i], tensorArena, tensorArenaSize,
+					  CONFIG_ETHOSU_BENCHMARK_ITERATIONS);
+
+		ReportResult(result);
+
+		if (result.status != Status::Ok) {
+			failures++;
+		}
+	}
+
+	ReportEnd();
+
+	return failures;
+}
@@ -0,0 +1,93 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "models.hpp"
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+/*
+ * The model headers define the same global names (networkModelData, inputData, ...), so each one
+ * is pulled into its own namespace. TENSOR_ARENA_SIZE is captured before the next header
+ * redefines it.
+ */
+namespace kws
+{
+#if defined(ETHOSU_ARCH_U85)
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/input.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/output.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u85/model_u85_256.h"
+#else
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/input.h"
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/output.h"
+#if defined(ETHOSU_BENCHMARK_U55_256)
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/model_u55_256.h"
+#else
+#include "ethosu/models/keyword_spotting_cnn_small_int8/u55/model_u55_128.h"
+#endif
+#endif
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+#undef TENSOR_ARENA_SIZE
+} /* namespace kws */
+
+#if defined(ETHOSU_ARCH_U85)
+/* BERT-Tiny is compiled as C sources, see CMakeLists.txt */
+extern "C" {
+#include "ethosu/models/bert_tiny/u85/model_u85_256.h"
+#include "ethosu/models/bert_tiny/u85/input.h"
+#include "ethosu/models/bert_tiny/u85/output.h"
+}
+
+namespace bert
+{
+constexpr size_t arenaSize = TENSOR_ARENA_SIZE;
+#undef TENSOR_ARENA_SIZE
+} /* namespace bert */
+#endif
+
+namespace EthosuBenchmark
+{
+const Model models[] = {
+	{
+		.name = "keyword_spotting_cnn_small_int8",
+		.networkModel = kws::networkModelData,
+		.networkModelSize = sizeof(kws::networkModelData),
+		.input = kws::inputData,
+		.inputSize = sizeof(kws::inputData),
+		.expectedOutput = kws::expectedOutputData,
+		.expectedOutputSize = sizeof(kws::expectedOutputData),
+		.arenaSize = kws::arenaSize,
+	},
+#if defined(ETHOSU_ARCH_U85)
+	{
+		.name = "bert_tiny",
+		.networkModel = networkModelData,
+		.networkModelSize = networkModelDataSize,
+		.input = inputData,
+		.inputSize = inputDataSize,
+		.expectedOutput = expectedOutputData,
+		.expectedOutputSize = expectedOutputDataSize,
+		.arenaSize = bert::arenaSize,
+	},
+#endif
+};
+
+const size_t modelCount = ARRAY_SIZE(models);
+
+#if defined(ETHOSU_ARCH_U85)
+#define BENCHMARK_ARENA_SIZE std::max(kws::arenaSize, bert::arenaSize)
+#else
+#define BENCHMARK_ARENA_SIZE kws::arenaSize
+#endif
+
+__attribute__((section(".bss.tflm_arena"), aligned(16))) uint8_t tensorArena[BENCHMARK_ARENA_SIZE];
+const size_t tensorArenaSize = BENCHMARK_ARENA_SIZE;
+} /* namespace EthosuBenchmark */
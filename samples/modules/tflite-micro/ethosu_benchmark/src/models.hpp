@@ -0,0 +1,36 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EthosuBenchmark
+{
+struct Model {
+	const char *name;
+	const uint8_t *networkModel;
+	size_t networkModelSize;
+	const uint8_t *input;
+	size_t inputSize;
+	const uint8_t *expectedOutput;
+	size_t expectedOutputSize;
+	/* Arena size the model header asks for, the shared arena is at least this big */
+	size_t arenaSize;
+};
+
+/* All models bundled under include/ethosu/models for the configured NPU */
+extern const Model models[];
+extern const size_t modelCount;
+
+/* Tensor arena shared by all models, sized for the largest one */
+extern uint8_t tensorArena[];
+extern const size_t tensorArenaSize;
+} /* namespace EthosuBenchmark */
@@ -0,0 +1,54 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "report.hpp"
+
+#include <zephyr/kernel.h>
+
+namespace EthosuBenchmark
+{
+#if defined(CONFIG_ETHOSU_BENCHMARK_REPORT_JSON)
+#define REPORT_FORMAT "json"
+#else
+#define REPORT_FORMAT "csv"
+#endif
+
+void ReportBegin(void)
+{
+	printk("--- ethosu_benchmark report begin (%s) ---\n", REPORT_FORMAT);
+
+#if defined(CONFIG_ETHOSU_BENCHMARK_REPORT_CSV)
+	printk("board,npu,model,status,iterations,setup_us,cold_us,warm_min_us,warm_avg_us,"
+	       "warm_max_us,inferences_per_s,arena_size,arena_used\n");
+#endif
+}
+
+void ReportResult(const Result &r)
+{
+#if defined(CONFIG_ETHOSU_BENCHMARK_REPORT_JSON)
+	printk("{\"board\":\"%s\",\"npu\":\"%s\",\"model\":\"%s\",\"status\":\"%s\","
+	       "\"iterations\":%u,\"setup_us\":%u,\"cold_us\":%u,\"warm_min_us\":%u,"
+	       "\"warm_avg_us\":%u,\"warm_max_us\":%u,\"inferences_per_s\":%u.%02u,"
+	       "\"arena_size\":%zu,\"arena_used\":%zu}\n",
+	       CONFIG_BOARD, ETHOSU_BENCHMARK_NPU, r.model, StatusName(r.status), r.iterations,
+	       r.setupUs, r.coldUs, r.warmMinUs, r.warmAvgUs, r.warmMaxUs, r.throughputX100 / 100,
+	       r.throughputX100 % 100, r.arenaSize, r.arenaUsed);
+#else
+	printk("%s,%s,%s,%s,%u,%u,%u,%u,%u,%u,%u.%02u,%zu,%zu\n", CONFIG_BOARD,
+	       ETHOSU_BENCHMARK_NPU, r.model, StatusName(r.status), r.iterations, r.setupUs,
+	       r.coldUs, r.warmMinUs, r.warmAvgUs, r.warmMaxUs, r.throughputX100 / 100,
+	       r.throughputX100 % 100, r.arenaSize, r.arenaUsed);
+#endif
+}
+
+void ReportEnd(void)
+{
+	printk("--- ethosu_benchmark report end ---\n");
+}
+} /* namespace EthosuBenchmark */
@@ -0,0 +1,24 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#pragma once
+
+#include "benchmark.hpp"
+
+namespace EthosuBenchmark
+{
+/*
+ * The report is printed between begin/end marker lines so it can be cut out of a console log.
+ * Field order and names are fixed: a host build with the NPU stubbed produces the same columns
+ * as a hardware run, which keeps reports from different SDK versions diffable.
+ */
+void ReportBegin(void);
+void ReportResult(const Result &result);
+void ReportEnd(void);
+} /* namespace EthosuBenchmark */
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+"""
+Compare AIPL benchmark results against a stored baseline.
+
+The AIPL benchmark sample (samples/aipl/benchmark) built with
+CONFIG_BENCHMARK_OUTPUT_JSON prints one JSON object per line:
+
+    {"op":"Resize","src":"RGB888","dst":"RGB888","width":192,"height":192,...}
+
+Both inputs may be raw console logs; lines without a JSON object are ignored.
+Results are matched on operation, formats and size, and the chosen metric is
+compared. The exit status is 1 if any result regressed by more than the
+threshold, so the script can gate CI. Save a run as the new baseline with
+--write-baseline.
+"""
+
+import argparse
+import json
+import sys
+
+KEY_FIELDS = ('op', 'src', 'dst', 'width', 'height')
+
+
+def parse_results(path):
+    """Return {key: result} for every benchmark JSON line in the file."""
+    results = {}
+
+    with open(path, errors='replace') as log:
+        for line in log:
+            start = line.find('{')
+            if start < 0:
+                continue
+
+            try:
+                result = json.loads(line[start:])
+            except json.JSONDecodeError:
+                continue
+
+            if not all(field in result for field in KEY_FIELDS):
+                continue
+
+            results[tuple(result[field] for field in KEY_FIELDS)] = result
+
+    return results
+
+
+def key_str(key):
+    op, src, dst, width, height = key
+    fmt = src if src == dst else f'{src}->{dst}'
+    return f'{op} {fmt} {width}x{height}'
+
+
+def compare(baseline, current, metric, threshold, min_delta):
+    """Return lists of (key, old, new, change %) for regressions and improvements."""
+    regressions = []
+    improvements = []
+
+    for key in sorted(baseline.keys() & current.keys(), key=key_str):
+        old = baseline[key].get(metric)
+        new = current[key].get(metric)
+        if not old or new is None:
+            continue
+
+        change = (new - old) * 100.0 / old
+        if abs(new - old) < min_delta:
+            continue
+
+        if change > threshold:
+            regressions.append((key, old, new, change))
+        elif change < -threshold:
+            improvements.append((key, old, new, change))
+
+    return regressions, improvements
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument('baseline', help='baseline JSON Lines file')
+    parser.add_argument('current', help='console log or JSON Lines file of the new run')
+    parser.add_argument(
+        '--metric', default='median_us', help='result field to compare (default: median_us)'
+    )
+    parser.add_argument(
+        '--threshold',
+        type=float,
+        default=10.0,
+        help='allowed change in percent before reporting (default: 10)',
+    )
+    parser.add_argument(
+        '--min-delta',
+        type=float,
+        default=5.0,
+        help='ignore changes smaller than this absolute amount (default: 5)',
+    )
+    parser.add_argument(
+        '--write-baseline',
+        action='store_true',
+        help='store the results of CURRENT as BASELINE instead of comparing',
+    )
+    args = parser.parse_args()
+
+    current = parse_results(args.current)
+    if not current:
+        sys.exit(f'error: no benchmark results found in {args.current}')
+
+    if args.write_baseline:
+        with open(args.baseline, 'w') as out:
+            for key in sorted(current, key=key_str):
+                out.write(json.dumps(current[key], separators=(',', ':')) + '\n')
+        print(f'{len(current)} results written to {args.baseline}')
+        return 0
+
+    # Headless builds leave out fields they cannot measure (cpu_load, fps)
+    if not any(args.metric in result for result in current.values()):
+        sys.exit(f'error: {args.metric} is not reported in {args.current}')
+
+    baseline = parse_results(args.baseline)
+    regressions, improvements = compare(
+        baseline, current, args.metric, args.threshold, args.min_delta
+    )
+
+    for title, rows in (('Regressions', regressions), ('Improvements', improvements)):
+        if not rows:
+            continue
+        print(f'{title} ({args.metric}, threshold {args.threshold:g}%):')
+        for key, old, new, change in rows:
+            print(f'  {key_str(key):<48} {old:>10} -> {new:>10} ({change:+.1f}%)')
+
+    missing = baseline.keys() - current.keys()
+    added = current.keys() - baseline.keys()
+    for title, keys in (('Missing from the new run', missing), ('Not in the baseline', added)):
+        if keys:
+            print(f'{title}:')
+            for key in sorted(keys, key=key_str):
+                print(f'  {key_str(key)}')
+
+    compared = len(baseline.keys() & current.keys())
+    print(
+        f'{compared} results compared, {len(regressions)} regressions, '
+        f'{len(improvements)} improvements'
+    )
+
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
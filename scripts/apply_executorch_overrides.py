@@ -152,6 +152,7 @@ def apply_overrides(workspace_root: Path) -> int:
 
     # Copy all override files
     override_files = [
+        'examples/arm/executor_runner/arm_peak_memory_allocator.h',
         'examples/arm/zephyr/src/arm_executor_runner.cpp',
         'examples/arm/zephyr/prj.conf',
         'examples/models/__init__.py',
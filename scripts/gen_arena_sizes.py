@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+"""
+Generate a header with tight tensor arena / allocator pool sizes.
+
+Build the application with generous pool sizes, run it and capture the console
+log. Applications print one line per pool:
+
+    arena_hwm: model=<name> pool=<pool> macro=<MACRO> used=<bytes> size=<bytes>
+
+This script takes the largest "used" value per macro from one or more logs,
+adds a safety margin, rounds up to the alignment and writes a header that
+redefines each macro. Pass it back to the build with:
+
+    west build ... -- -DARENA_SIZES_HEADER=<path to header>
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+HWM_RE = re.compile(
+    r"arena_hwm: model=(?P<model>\S+) pool=(?P<pool>\S+) macro=(?P<macro>[A-Za-z_][A-Za-z0-9_]*)"
+    r" used=(?P<used>\d+) size=(?P<size>\d+)"
+)
+
+
+def parse_logs(paths):
+    """Return {macro: (used, size, [model/pool, ...])} keeping the largest usage per macro."""
+    pools = {}
+
+    for path in paths:
+        with open(path, errors='replace') as log:
+            for line in log:
+                match = HWM_RE.search(line)
+                if not match:
+                    continue
+
+                macro = match['macro']
+                used = int(match['used'])
+                size = int(match['size'])
+                source = f"{match['model']}/{match['pool']}"
+
+                prev_used, prev_size, sources = pools.get(macro, (0, 0, []))
+                if source not in sources:
+                    sources.append(source)
+                pools[macro] = (max(used, prev_used), max(size, prev_size), sources)
+
+    return pools
+
+
+def tight_size(used, margin, align):
+    size = used + (used * margin + 99) // 100
+    size = max(size, align)
+    return (size + align - 1) // align * align
+
+
+def render(pools, margin, align, logs):
+    out = [
+        '/* Generated by scripts/gen_arena_sizes.py, do not edit.',
+        ' *',
+        f' * Source logs: {", ".join(Path(p).name for p in logs)}',
+        f' * Margin: {margin}%, alignment: {align} bytes',
+        ' */',
+        '',
+        '#pragma once',
+        '',
+    ]
+
+    for macro in sorted(pools):
+        used, size, sources = pools[macro]
+        tight = tight_size(used, margin, align)
+        out.append(f'/* {", ".join(sources)}: used {used} of {size} bytes */')
+        out.append(f'#undef {macro}')
+        out.append(f'#define {macro} {tight}')
+        out.append('')
+
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('logs', nargs='+', help='console log(s) containing arena_hwm lines')
+    parser.add_argument('-o', '--output', required=True, help='header to generate')
+    parser.add_argument('--margin', type=int, default=5,
+                        help='safety margin in percent added to the measured usage (default: 5)')
+    parser.add_argument('--align', type=int, default=16,
+                        help='round sizes up to this many bytes (default: 16)')
+    args = parser.parse_args()
+
+    pools = parse_logs(args.logs)
+    if not pools:
+        print('Error: no arena_hwm lines found', file=sys.stderr)
+        return 1
+
+    for macro, (used, size, _) in sorted(pools.items()):
+        if used >= size:
+            print(f'Warning: {macro} was exhausted ({used} >= {size}), '
+                  'rerun with a larger pool for an exact figure', file=sys.stderr)
+
+    Path(args.output).write_text(render(pools, args.margin, args.align, args.logs))
+
+    for macro, (used, size, _) in sorted(pools.items()):
+        print(f'{macro}: {size} -> {tight_size(used, args.margin, args.align)} bytes')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
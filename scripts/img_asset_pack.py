@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+# Use, distribution and modification of this code is permitted under the
+# terms stated in the Alif Semiconductor Software License Agreement
+#
+# You should have received a copy of the Alif Semiconductor Software
+# License Agreement with this file. If not, please write to:
+# contact@alifsemi.com, or visit: https://alifsemi.com/license
+
+"""
+Pack images into the compressed img_assets store.
+
+Every image is stored once as a QOI stream and expanded at run time into the
+requested color format by img_asset_decode() / img_asset_decode_rows(), see
+subsys/img_assets/img_asset.h. The script writes a C source with the streams
+and the asset index, and a header declaring one IMG_ASSET_<NAME> per image:
+
+    scripts/img_asset_pack.py -o subsys/img_assets/img_asset_data \\
+        sample_photo=photo.png logo=logo.qoi
+
+Accepted inputs:
+  *.qoi  stored as is
+  *.c    legacy img_assets array in ARGB8888, RGBA8888, RGB888 or BGR888
+  other  any image Pillow can open
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+QOI_MAGIC = b"qoif"
+QOI_PADDING = b"\x00" * 7 + b"\x01"
+
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_RGB = 0xFE
+QOI_OP_RGBA = 0xFF
+
+LICENSE = """/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+"""
+
+# Byte order of one pixel in memory for the legacy arrays, as (R, G, B, A) offsets.
+LEGACY_LAYOUTS = {
+    "COLOR_ARGB8888": (4, (2, 1, 0, 3)),
+    "COLOR_RGBA8888": (4, (3, 2, 1, 0)),
+    "COLOR_RGB888": (3, (2, 1, 0, None)),
+    "COLOR_BGR888": (3, (0, 1, 2, None)),
+}
+
+
+def qoi_hash(r, g, b, a):
+    return (r * 3 + g * 5 + b * 7 + a * 11) % 64
+
+
+def qoi_encode(width, height, rgba):
+    """Encode a flat list of (r, g, b, a) tuples as a QOI stream."""
+    out = bytearray(QOI_MAGIC)
+    out += struct.pack(">IIBB", width, height, 4, 0)
+
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+
+    for i, px in enumerate(rgba):
+        if px == prev:
+            run += 1
+            if run == 62 or i == len(rgba) - 1:
+                out.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+
+        if run:
+            out.append(QOI_OP_RUN | (run - 1))
+            run = 0
+
+        h = qoi_hash(*px)
+        if index[h] == px:
+            out.append(QOI_OP_INDEX | h)
+        else:
+            index[h] = px
+            r, g, b, a = px
+            if a == prev[3]:
+                dr = (r - prev[0] + 128) % 256 - 128
+                dg = (g - prev[1] + 128) % 256 - 128
+                db = (b - prev[2] + 128) % 256 - 128
+                dr_dg = dr - dg
+                db_dg = db - dg
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                    out.append(QOI_OP_LUMA | (dg + 32))
+                    out.append((dr_dg + 8) << 4 | (db_dg + 8))
+                else:
+                    out += bytes((QOI_OP_RGB, r, g, b))
+            else:
+                out += bytes((QOI_OP_RGBA, r, g, b, a))
+        prev = px
+
+    out += QOI_PADDING
+    return bytes(out)
+
+
+def load_qoi(path):
+    data = path.read_bytes()
+    if data[:4] != QOI_MAGIC or len(data) < 14 + len(QOI_PADDING):
+        raise ValueError(f"{path}: not a QOI image")
+    width, height = struct.unpack(">II", data[4:12])
+    return width, height, data
+
+
+def load_legacy_c(path):
+    text = path.read_text()
+    body = re.search(r"_DATA\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    fmt = re.search(r"\.format\s*=\s*(COLOR_\w+)", text)
+    width = re.search(r"\.width\s*=\s*(\d+)", text)
+    height = re.search(r"\.height\s*=\s*(\d+)", text)
+    if not (body and fmt and width and height):
+        raise ValueError(f"{path}: not an img_assets array")
+    if fmt.group(1) not in LEGACY_LAYOUTS:
+        raise ValueError(f"{path}: {fmt.group(1)} cannot be packed, use a 24 or 32 bit format")
+
+    raw = bytes(int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+", body.group(1)))
+    bpp, (ro, go, bo, ao) = LEGACY_LAYOUTS[fmt.group(1)]
+    w, h = int(width.group(1)), int(height.group(1))
+    if len(raw) != w * h * bpp:
+        raise ValueError(f"{path}: expected {w * h * bpp} bytes, found {len(raw)}")
+
+    rgba = [
+        (raw[p + ro], raw[p + go], raw[p + bo], raw[p + ao] if ao is not None else 255)
+        for p in range(0, len(raw), bpp)
+    ]
+    return w, h, qoi_encode(w, h, rgba)
+
+
+def load_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit(f"{path}: Pillow is required for this input, pip install pillow")
+
+    with Image.open(path) as img:
+        img = img.convert("RGBA")
+        return img.width, img.height, qoi_encode(img.width, img.height, list(img.getdata()))
+
+
+def load(path):
+    if path.suffix == ".qoi":
+        return load_qoi(path)
+    if path.suffix == ".c":
+        return load_legacy_c(path)
+    return load_image(path)
+
+
+def c_array(data, indent="\t", per_line=15):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_outputs(base, assets):
+    header = base.with_suffix(".h")
+    source = base.with_suffix(".c")
+    guard = header.name.upper().replace(".", "_")
+
+    h = [LICENSE, f"/* Generated by scripts/{Path(__file__).name}, do not edit. */", ""]
+    h += [f"#ifndef {guard}", f"#define {guard}", "", '#include "img_asset.h"', ""]
+    h += [f"extern const struct img_asset IMG_ASSET_{name.upper()};" for name, *_ in assets]
+    h += ["", f"#endif /* {guard} */", ""]
+
+    c = [LICENSE, f"/* Generated by scripts/{Path(__file__).name}, do not edit. */", ""]
+    c += [f'#include "{header.name}"', ""]
+    for name, width, height, qoi in assets:
+        sym = name.upper()
+        c += [f"static const uint8_t IMG_ASSET_{sym}_QOI[] = {{", c_array(qoi), "};", ""]
+        c += [f"const struct img_asset IMG_ASSET_{sym} = {{"]
+        c += [f'\t.name = "{name}",']
+        c += [f"\t.data = IMG_ASSET_{sym}_QOI,"]
+        c += [f"\t.data_size = sizeof(IMG_ASSET_{sym}_QOI),"]
+        c += [f"\t.width = {width},", f"\t.height = {height},", "};", ""]
+    c += ["const struct img_asset *const img_asset_index[] = {"]
+    c += [f"\t&IMG_ASSET_{name.upper()}," for name, *_ in assets]
+    c += ["};", "", f"const size_t img_asset_count = {len(assets)};", ""]
+
+    header.write_text("\n".join(h))
+    source.write_text("\n".join(c))
+    return header, source
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument(
+        "-o", "--output", type=Path, required=True,
+        help="output path without extension, a .c and a .h file are written"
+    )
+    parser.add_argument("images", nargs="+", metavar="NAME=PATH", help="asset name and source image")
+    args = parser.parse_args()
+
+    assets = []
+    for spec in args.images:
+        name, sep, path = spec.partition("=")
+        if not sep or not re.fullmatch(r"[a-z][a-z0-9_]*", name):
+            sys.exit(f"{spec}: expected NAME=PATH with a lower case C identifier as NAME")
+        try:
+            width, height, qoi = load(Path(path))
+        except (OSError, ValueError) as e:
+            sys.exit(str(e))
+        raw = width * height * 4
+        print(f"{name}: {width}x{height}, {len(qoi)} bytes ({100 * len(qoi) / raw:.1f}% of ARGB8888)")
+        assets.append((name, width, height, qoi))
+
+    for path in write_outputs(args.output, assets):
+        print(f"wrote {path}")
+
+
+if __name__ == "__main__":
+    main()
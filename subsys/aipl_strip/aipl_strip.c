@@ -0,0 +1,413 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include "aipl_strip.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include <aipl_color_conversion.h>
+#include <aipl_rotate.h>
+#include <aipl_video_alloc.h>
+
+/* Image sizes are limited so that Q16 positions fit into 32 bits */
+#define MAX_DIMENSION 0x7fff
+
+#define Q16_ONE  0x10000
+#define Q16_HALF 0x8000
+
+/* Rows of one image currently in memory */
+struct strip_view {
+	uint8_t *data;
+	/* Line length in pixels */
+	uint32_t pitch;
+	uint32_t first;
+	uint32_t rows;
+};
+
+static const uint8_t format_bpp[] = {
+	[AIPL_COLOR_ALPHA8] = 1,   [AIPL_COLOR_ARGB8888] = 4, [AIPL_COLOR_ARGB4444] = 2,
+	[AIPL_COLOR_ARGB1555] = 2, [AIPL_COLOR_RGBA8888] = 4, [AIPL_COLOR_RGBA4444] = 2,
+	[AIPL_COLOR_RGBA5551] = 2, [AIPL_COLOR_BGR888] = 3,   [AIPL_COLOR_RGB888] = 3,
+	[AIPL_COLOR_RGB565] = 2,   [AIPL_COLOR_I400] = 1,     [AIPL_COLOR_YUY2] = 2,
+	[AIPL_COLOR_UYVY] = 2,
+};
+
+uint32_t aipl_strip_bytes_per_pixel(aipl_color_format_t format)
+{
+	if ((uint32_t)format >= sizeof(format_bpp)) {
+		return 0;
+	}
+
+	return format_bpp[format];
+}
+
+/* Formats where every byte is a channel, so bytes can be blended independently */
+static bool byte_channels(aipl_color_format_t format)
+{
+	switch (format) {
+	case AIPL_COLOR_ALPHA8:
+	case AIPL_COLOR_I400:
+	case AIPL_COLOR_ARGB8888:
+	case AIPL_COLOR_RGBA8888:
+	case AIPL_COLOR_BGR888:
+	case AIPL_COLOR_RGB888:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool pixel_pairs(aipl_color_format_t format)
+{
+	return format == AIPL_COLOR_YUY2 || format == AIPL_COLOR_UYVY;
+}
+
+/* Q16 distance between source samples of neighbouring output pixels */
+static inline uint32_t resize_step(uint32_t src, uint32_t dst)
+{
+	return (src * Q16_ONE) / dst;
+}
+
+/*
+ * Q16 source position of output pixel i. Bilinear sampling is centre
+ * aligned and clamped to the last source pixel; nearest-neighbour picks the
+ * source pixel under the centre of the output pixel.
+ */
+static inline int32_t resize_pos(uint32_t i, uint32_t step, uint32_t src, bool interpolate)
+{
+	int32_t pos = (int32_t)(step * i + step / 2);
+
+	if (!interpolate) {
+		return pos;
+	}
+
+	pos -= Q16_HALF;
+	if (pos < 0) {
+		return 0;
+	}
+
+	return MIN(pos, (int32_t)((src - 1) * Q16_ONE));
+}
+
+static void input_rows(const struct aipl_strip_pipeline *p, size_t k, uint32_t a, uint32_t b,
+		       uint32_t *ia, uint32_t *ib)
+{
+	const struct aipl_strip_op *op = &p->ops[k];
+	const struct aipl_strip_stage *in = &p->stage[k];
+
+	switch (op->type) {
+	case AIPL_STRIP_CROP:
+		*ia = a + op->crop.y;
+		*ib = b + op->crop.y;
+		break;
+	case AIPL_STRIP_RESIZE: {
+		const bool lerp = op->resize.interpolate;
+		const uint32_t step = resize_step(in->height, op->resize.height);
+		const uint32_t last = resize_pos(b - 1, step, in->height, lerp) >> 16;
+
+		*ia = resize_pos(a, step, in->height, lerp) >> 16;
+		/* Bilinear also reads the row below the last sample */
+		*ib = lerp ? MIN(last + 2, in->height) : last + 1;
+		break;
+	}
+	case AIPL_STRIP_ROTATE_180:
+		*ia = in->height - b;
+		*ib = in->height - a;
+		break;
+	default:
+		*ia = a;
+		*ib = b;
+		break;
+	}
+}
+
+static int check_op(const struct aipl_strip_op *op, const struct aipl_strip_stage *in,
+		    struct aipl_strip_stage *out)
+{
+	*out = (struct aipl_strip_stage){in->width, in->height, in->format, NULL, 0};
+
+	switch (op->type) {
+	case AIPL_STRIP_CROP:
+		if (op->crop.width == 0 || op->crop.height == 0 ||
+		    op->crop.x + op->crop.width > in->width ||
+		    op->crop.y + op->crop.height > in->height) {
+			return -EINVAL;
+		}
+		if (pixel_pairs(in->format) && ((op->crop.x | op->crop.width) & 1)) {
+			return -EINVAL;
+		}
+		out->width = op->crop.width;
+		out->height = op->crop.height;
+		return 0;
+	case AIPL_STRIP_RESIZE:
+		if (op->resize.width == 0 || op->resize.height == 0 ||
+		    op->resize.width > MAX_DIMENSION || op->resize.height > MAX_DIMENSION) {
+			return -EINVAL;
+		}
+		if (pixel_pairs(in->format) ||
+		    (op->resize.interpolate && !byte_channels(in->format))) {
+			return -ENOTSUP;
+		}
+		out->width = op->resize.width;
+		out->height = op->resize.height;
+		return 0;
+	case AIPL_STRIP_CONVERT:
+		if (aipl_strip_bytes_per_pixel(op->format) == 0) {
+			return -ENOTSUP;
+		}
+		out->format = op->format;
+		return 0;
+	case AIPL_STRIP_ROTATE_180:
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+int aipl_strip_init(struct aipl_strip_pipeline *p, uint32_t width, uint32_t height,
+		    aipl_color_format_t format, const struct aipl_strip_op *ops, size_t num_ops,
+		    uint32_t strip_rows)
+{
+	int ret;
+
+	memset(p, 0, sizeof(*p));
+
+	if (num_ops == 0 || num_ops > CONFIG_AIPL_STRIP_MAX_OPS || strip_rows == 0 ||
+	    width == 0 || height == 0 || width > MAX_DIMENSION || height > MAX_DIMENSION) {
+		return -EINVAL;
+	}
+
+	if (aipl_strip_bytes_per_pixel(format) == 0) {
+		return -ENOTSUP;
+	}
+
+	memcpy(p->ops, ops, num_ops * sizeof(ops[0]));
+	p->num_ops = num_ops;
+	p->strip_rows = strip_rows;
+	p->stage[0] = (struct aipl_strip_stage){width, height, format, NULL, 0};
+
+	for (size_t k = 0; k < num_ops; k++) {
+		ret = check_op(&p->ops[k], &p->stage[k], &p->stage[k + 1]);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* Walk all strips back to the source to size the intermediate buffers */
+	const uint32_t out_height = p->stage[num_ops].height;
+
+	for (uint32_t a = 0; a < out_height; a += strip_rows) {
+		uint32_t ia = a;
+		uint32_t ib = MIN(a + strip_rows, out_height);
+
+		for (size_t k = num_ops; k-- > 0;) {
+			if (k + 1 < num_ops && p->ops[k].type != AIPL_STRIP_CROP) {
+				p->stage[k + 1].buf_rows = MAX(p->stage[k + 1].buf_rows, ib - ia);
+			}
+			input_rows(p, k, ia, ib, &ia, &ib);
+		}
+	}
+
+	for (size_t k = 1; k < num_ops; k++) {
+		struct aipl_strip_stage *st = &p->stage[k];
+		const size_t size =
+			(size_t)st->width * st->buf_rows * aipl_strip_bytes_per_pixel(st->format);
+
+		if (size == 0) {
+			continue;
+		}
+
+		st->buf = aipl_video_alloc(size);
+		if (st->buf == NULL) {
+			aipl_strip_release(p);
+			return -ENOMEM;
+		}
+		p->buf_size += size;
+	}
+
+	return 0;
+}
+
+void aipl_strip_release(struct aipl_strip_pipeline *p)
+{
+	for (size_t k = 1; k < p->num_ops; k++) {
+		if (p->stage[k].buf) {
+			aipl_video_free(p->stage[k].buf);
+			p->stage[k].buf = NULL;
+		}
+	}
+
+	p->buf_size = 0;
+}
+
+int aipl_strip_create_output(const struct aipl_strip_pipeline *p, aipl_image_t *dst)
+{
+	const struct aipl_strip_stage *out = &p->stage[p->num_ops];
+
+	if (aipl_image_create(dst, out->width, out->width, out->height, out->format) !=
+	    AIPL_ERR_OK) {
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static inline uint8_t *view_row(const struct strip_view *v, uint32_t row, uint32_t bpp)
+{
+	return v->data + (size_t)(row - v->first) * v->pitch * bpp;
+}
+
+static inline aipl_image_t view_image(const struct strip_view *v, uint32_t width,
+				      aipl_color_format_t format)
+{
+	return (aipl_image_t){v->data, v->pitch, width, v->rows, format};
+}
+
+static void resize_rows(const struct aipl_strip_op *op, const struct aipl_strip_stage *in,
+			const struct strip_view *src, const struct strip_view *dst, uint32_t bpp)
+{
+	const uint32_t dw = op->resize.width;
+	const uint32_t dh = op->resize.height;
+	const bool lerp = op->resize.interpolate;
+	const uint32_t xstep = resize_step(in->width, dw);
+	const uint32_t ystep = resize_step(in->height, dh);
+
+	for (uint32_t y = dst->first; y < dst->first + dst->rows; y++) {
+		const int32_t py = resize_pos(y, ystep, in->height, lerp);
+		const uint32_t y0 = py >> 16;
+		const uint8_t *r0 = view_row(src, y0, bpp);
+		const uint8_t *r1 = view_row(src, MIN(y0 + 1, in->height - 1), bpp);
+		const uint32_t fy = (py >> 8) & 0xff;
+		uint8_t *out = view_row(dst, y, bpp);
+
+		for (uint32_t x = 0; x < dw; x++) {
+			const int32_t px = resize_pos(x, xstep, in->width, lerp);
+			const uint32_t x0 = px >> 16;
+
+			if (!lerp) {
+				memcpy(out, &r0[x0 * bpp], bpp);
+				out += bpp;
+				continue;
+			}
+
+			const uint32_t x1 = MIN(x0 + 1, in->width - 1);
+			const uint32_t fx = (px >> 8) & 0xff;
+
+			for (uint32_t c = 0; c < bpp; c++) {
+				const uint32_t top =
+					r0[x0 * bpp + c] * (256 - fx) + r0[x1 * bpp + c] * fx;
+				const uint32_t bot =
+					r1[x0 * bpp + c] * (256 - fx) + r1[x1 * bpp + c] * fx;
+
+				*out++ = (top * (256 - fy) + bot * fy + Q16_HALF) >> 16;
+			}
+		}
+	}
+}
+
+/* Make rows [a, b) of stage k resident and describe where they are */
+static int produce(struct aipl_strip_pipeline *p, size_t k, uint32_t a, uint32_t b,
+		   const aipl_image_t *src, aipl_image_t *dst, struct strip_view *out)
+{
+	if (k == 0) {
+		*out = (struct strip_view){src->data, src->pitch, 0, src->height};
+		return 0;
+	}
+
+	const struct aipl_strip_op *op = &p->ops[k - 1];
+	const struct aipl_strip_stage *in_st = &p->stage[k - 1];
+	const struct aipl_strip_stage *st = &p->stage[k];
+	const uint32_t in_bpp = aipl_strip_bytes_per_pixel(in_st->format);
+	const uint32_t bpp = aipl_strip_bytes_per_pixel(st->format);
+	struct strip_view in;
+	uint32_t ia;
+	uint32_t ib;
+	int ret;
+
+	input_rows(p, k - 1, a, b, &ia, &ib);
+	ret = produce(p, k - 1, ia, ib, src, dst, &in);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (op->type == AIPL_STRIP_CROP) {
+		const struct strip_view view = {
+			view_row(&in, ia, in_bpp) + op->crop.x * in_bpp, in.pitch, a, b - a};
+
+		if (k < p->num_ops) {
+			*out = view;
+			return 0;
+		}
+
+		/* A crop at the end of the chain still has to land in dst */
+		for (uint32_t y = a; y < b; y++) {
+			memcpy((uint8_t *)dst->data + (size_t)y * dst->pitch * bpp,
+			       view_row(&view, y, bpp), (size_t)st->width * bpp);
+		}
+		return 0;
+	}
+
+	if (k == p->num_ops) {
+		*out = (struct strip_view){(uint8_t *)dst->data + (size_t)a * dst->pitch * bpp,
+					   dst->pitch, a, b - a};
+	} else {
+		*out = (struct strip_view){st->buf, st->width, a, b - a};
+	}
+
+	in.data = view_row(&in, ia, in_bpp);
+	in.first = ia;
+	in.rows = ib - ia;
+
+	aipl_image_t in_img = view_image(&in, in_st->width, in_st->format);
+	aipl_image_t out_img = view_image(out, st->width, st->format);
+
+	switch (op->type) {
+	case AIPL_STRIP_RESIZE:
+		resize_rows(op, in_st, &in, out, bpp);
+		return 0;
+	case AIPL_STRIP_CONVERT:
+		ret = aipl_color_convert_img(&in_img, &out_img);
+		break;
+	case AIPL_STRIP_ROTATE_180:
+		ret = aipl_rotate_img(&in_img, &out_img, AIPL_ROTATE_180);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return ret == AIPL_ERR_OK ? 0 : -EIO;
+}
+
+int aipl_strip_run(struct aipl_strip_pipeline *p, const aipl_image_t *src, aipl_image_t *dst)
+{
+	const struct aipl_strip_stage *first = &p->stage[0];
+	const struct aipl_strip_stage *last = &p->stage[p->num_ops];
+	struct strip_view view;
+
+	if (src->width != first->width || src->height != first->height ||
+	    src->format != first->format || src->pitch < src->width ||
+	    dst->width != last->width || dst->height != last->height ||
+	    dst->format != last->format || dst->pitch < dst->width) {
+		return -EINVAL;
+	}
+
+	for (uint32_t a = 0; a < last->height; a += p->strip_rows) {
+		const uint32_t b = MIN(a + p->strip_rows, last->height);
+		int ret = produce(p, p->num_ops, a, b, src, dst, &view);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
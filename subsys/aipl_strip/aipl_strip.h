@@ -0,0 +1,137 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   aipl_strip.h
+ *
+ * Strip pipeline for AIPL image operations. A chain of operations is run
+ * over horizontal strips of the final image: for every strip of output rows
+ * each operation only computes the rows the next one needs, so an
+ * intermediate image never holds more than a strip plus the few extra rows
+ * a resize reads. Crops are views into the previous image and need no
+ * buffer at all.
+ *
+ * Only packed formats are supported, as a planar image cannot be addressed
+ * row by row. Rotation by 90 or 270 degrees reads columns and is not
+ * available; run it on the final image.
+ */
+#ifndef __AIPL_STRIP_H
+#define __AIPL_STRIP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <aipl_image.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum aipl_strip_op_type {
+	/* Window of the input image, no copy. */
+	AIPL_STRIP_CROP,
+	/* Nearest-neighbour or bilinear scaling, done by this module. */
+	AIPL_STRIP_RESIZE,
+	/* aipl_color_convert_img() on every strip. */
+	AIPL_STRIP_CONVERT,
+	/* aipl_rotate_img() with AIPL_ROTATE_180 on every strip. */
+	AIPL_STRIP_ROTATE_180,
+};
+
+struct aipl_strip_op {
+	enum aipl_strip_op_type type;
+	union {
+		struct {
+			uint32_t x;
+			uint32_t y;
+			uint32_t width;
+			uint32_t height;
+		} crop;
+		struct {
+			uint32_t width;
+			uint32_t height;
+			/* Bilinear, only for formats with 8-bit channels. */
+			bool interpolate;
+		} resize;
+		aipl_color_format_t format;
+	};
+};
+
+#define AIPL_STRIP_OP_CROP(_x, _y, _w, _h)                                                         \
+	{.type = AIPL_STRIP_CROP, .crop = {.x = (_x), .y = (_y), .width = (_w), .height = (_h)}}
+#define AIPL_STRIP_OP_RESIZE(_w, _h, _interpolate)                                                 \
+	{.type = AIPL_STRIP_RESIZE,                                                                \
+	 .resize = {.width = (_w), .height = (_h), .interpolate = (_interpolate)}}
+#define AIPL_STRIP_OP_CONVERT(_format) {.type = AIPL_STRIP_CONVERT, .format = (_format)}
+#define AIPL_STRIP_OP_ROTATE_180()     {.type = AIPL_STRIP_ROTATE_180}
+
+struct aipl_strip_stage {
+	uint32_t width;
+	uint32_t height;
+	aipl_color_format_t format;
+	/* Rows of this image resident at a time, NULL for views and the output. */
+	uint8_t *buf;
+	uint32_t buf_rows;
+};
+
+struct aipl_strip_pipeline {
+	struct aipl_strip_op ops[CONFIG_AIPL_STRIP_MAX_OPS];
+	/* Image after every operation; stage 0 is the source. */
+	struct aipl_strip_stage stage[CONFIG_AIPL_STRIP_MAX_OPS + 1];
+	size_t num_ops;
+	uint32_t strip_rows;
+	/* Total size of the strip buffers in bytes. */
+	size_t buf_size;
+};
+
+/**
+ * @brief Validate a chain of operations and allocate its strip buffers.
+ *
+ * @param p Pipeline to set up.
+ * @param width Source width in pixels.
+ * @param height Source height in pixels.
+ * @param format Source format.
+ * @param ops Operations, applied in order. The array is copied.
+ * @param num_ops Number of operations, 1..CONFIG_AIPL_STRIP_MAX_OPS.
+ * @param strip_rows Output rows produced per step.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if an operation does not fit its input.
+ * @retval -ENOTSUP if a format is planar or cannot be interpolated.
+ * @retval -ENOMEM if the strip buffers could not be allocated.
+ */
+int aipl_strip_init(struct aipl_strip_pipeline *p, uint32_t width, uint32_t height,
+		    aipl_color_format_t format, const struct aipl_strip_op *ops, size_t num_ops,
+		    uint32_t strip_rows);
+
+/* Free the strip buffers. */
+void aipl_strip_release(struct aipl_strip_pipeline *p);
+
+/* Allocate an image matching the pipeline output with aipl_image_create(). */
+int aipl_strip_create_output(const struct aipl_strip_pipeline *p, aipl_image_t *dst);
+
+/**
+ * @brief Run the pipeline over one source image.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p src or @p dst do not match the pipeline.
+ * @retval -EIO if an AIPL operation failed.
+ */
+int aipl_strip_run(struct aipl_strip_pipeline *p, const aipl_image_t *src, aipl_image_t *dst);
+
+/* Bytes per pixel of a packed format, 0 for planar formats. */
+uint32_t aipl_strip_bytes_per_pixel(aipl_color_format_t format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __AIPL_STRIP_H */
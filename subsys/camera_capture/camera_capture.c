@@ -0,0 +1,365 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/logging/log.h>
+#include "camera_capture.h"
+
+LOG_MODULE_REGISTER(camera_capture, CONFIG_CAMERA_CAPTURE_LOG_LEVEL);
+
+#define MAX_BUFFERS CONFIG_CAMERA_CAPTURE_MAX_BUFFERS
+
+static K_THREAD_STACK_DEFINE(capture_stack, CONFIG_CAMERA_CAPTURE_THREAD_STACK_SIZE);
+static struct k_thread capture_thread;
+
+static struct {
+	const struct device *dev;
+	enum camera_capture_mode mode;
+	uint8_t num_frames;
+	bool streaming;
+	struct camera_frame frames[MAX_BUFFERS];
+
+	/* Frames waiting for camera_capture_get(), oldest first. */
+	struct camera_frame *ready[MAX_BUFFERS];
+	uint8_t ready_head;
+	uint8_t ready_count;
+
+	uint32_t sequence;
+	struct camera_capture_stats stats;
+	struct k_mutex lock;
+	struct k_sem ready_sem;
+} cc;
+
+uint32_t camera_capture_pitch(uint32_t pixelformat, uint32_t width)
+{
+	switch (pixelformat) {
+	case VIDEO_PIX_FMT_RGB888_PLANAR_PRIVATE:
+	case VIDEO_PIX_FMT_NV24:
+	case VIDEO_PIX_FMT_NV42:
+		return width * 3;
+	case VIDEO_PIX_FMT_RGB565:
+	case VIDEO_PIX_FMT_Y10P:
+	case VIDEO_PIX_FMT_BGGR10:
+	case VIDEO_PIX_FMT_GBRG10:
+	case VIDEO_PIX_FMT_GRBG10:
+	case VIDEO_PIX_FMT_RGGB10:
+	case VIDEO_PIX_FMT_BGGR12:
+	case VIDEO_PIX_FMT_GBRG12:
+	case VIDEO_PIX_FMT_GRBG12:
+	case VIDEO_PIX_FMT_RGGB12:
+	case VIDEO_PIX_FMT_BGGR14:
+	case VIDEO_PIX_FMT_GBRG14:
+	case VIDEO_PIX_FMT_GRBG14:
+	case VIDEO_PIX_FMT_RGGB14:
+	case VIDEO_PIX_FMT_BGGR16:
+	case VIDEO_PIX_FMT_GBRG16:
+	case VIDEO_PIX_FMT_GRBG16:
+	case VIDEO_PIX_FMT_RGGB16:
+	case VIDEO_PIX_FMT_Y10:
+	case VIDEO_PIX_FMT_Y12:
+	case VIDEO_PIX_FMT_Y14:
+	case VIDEO_PIX_FMT_YUYV:
+	case VIDEO_PIX_FMT_YVYU:
+	case VIDEO_PIX_FMT_VYUY:
+	case VIDEO_PIX_FMT_UYVY:
+	case VIDEO_PIX_FMT_NV16:
+	case VIDEO_PIX_FMT_NV61:
+	case VIDEO_PIX_FMT_YUV422P:
+		return width << 1;
+	case VIDEO_PIX_FMT_NV12:
+	case VIDEO_PIX_FMT_NV21:
+	case VIDEO_PIX_FMT_YUV420:
+	case VIDEO_PIX_FMT_YVU420:
+		return (width * 3) >> 1;
+	default:
+		return width;
+	}
+}
+
+static void log_format(const char *what, const struct video_format *fmt)
+{
+	LOG_INF("%s: %c%c%c%c %ux%u pitch %u", what, (char)fmt->pixelformat,
+		(char)(fmt->pixelformat >> 8), (char)(fmt->pixelformat >> 16),
+		(char)(fmt->pixelformat >> 24), fmt->width, fmt->height, fmt->pitch);
+}
+
+static int set_format(enum video_endpoint_id ep, const struct camera_capture_config *cfg,
+		      struct video_format *fmt)
+{
+	struct video_caps caps;
+	const struct video_format_cap *found = NULL;
+
+	if (video_get_caps(cc.dev, ep, &caps)) {
+		LOG_ERR("Unable to retrieve video capabilities");
+		return -EIO;
+	}
+
+	for (int i = 0; caps.format_caps[i].pixelformat; i++) {
+		if (caps.format_caps[i].pixelformat == cfg->pixelformat) {
+			found = &caps.format_caps[i];
+			break;
+		}
+	}
+
+	if (!found) {
+		LOG_ERR("Pixel format %c%c%c%c is not supported", (char)cfg->pixelformat,
+			(char)(cfg->pixelformat >> 8), (char)(cfg->pixelformat >> 16),
+			(char)(cfg->pixelformat >> 24));
+		return -ENOTSUP;
+	}
+
+	fmt->pixelformat = cfg->pixelformat;
+	fmt->width = cfg->width ? cfg->width : found->width_min;
+	fmt->height = cfg->height ? cfg->height : found->height_min;
+	fmt->pitch = camera_capture_pitch(fmt->pixelformat, fmt->width);
+	log_format("capture format", fmt);
+
+	return video_set_format(cc.dev, ep, fmt);
+}
+
+/* Hand the buffer back to the driver; the stream may have stopped for lack of buffers. */
+static void recycle(struct camera_frame *frame)
+{
+	int ret = video_enqueue(cc.dev, VIDEO_EP_OUT, frame->vbuf);
+
+	if (ret) {
+		LOG_ERR("Unable to requeue video buf. ret - %d", ret);
+		return;
+	}
+
+	if (cc.streaming) {
+		ret = video_stream_start(cc.dev);
+		if (ret && ret != -EBUSY) {
+			LOG_ERR("Unable to restart capture. ret - %d", ret);
+		}
+	}
+}
+
+static struct camera_frame *frame_of(const struct video_buffer *vbuf)
+{
+	for (int i = 0; i < cc.num_frames; i++) {
+		if (cc.frames[i].vbuf == vbuf) {
+			return &cc.frames[i];
+		}
+	}
+	return NULL;
+}
+
+static void capture_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct video_buffer *vbuf;
+		struct camera_frame *frame;
+		struct camera_frame *stale = NULL;
+		int ret;
+
+		ret = video_dequeue(cc.dev, VIDEO_EP_OUT, &vbuf, K_FOREVER);
+		if (ret) {
+			LOG_ERR("Unable to dequeue video buf. ret - %d", ret);
+			k_msleep(10);
+			continue;
+		}
+
+		frame = frame_of(vbuf);
+		if (!frame) {
+			/* Not ours, but the driver must not lose it */
+			LOG_ERR("Unknown video buf %p", (void *)vbuf);
+			video_enqueue(cc.dev, VIDEO_EP_OUT, vbuf);
+			continue;
+		}
+
+		frame->timestamp_us = k_ticks_to_us_floor64(k_uptime_ticks());
+		frame->hw_timestamp_ms = vbuf->timestamp;
+		frame->size = vbuf->bytesused;
+		/* Reference held by the ready queue, passed on by camera_capture_get() */
+		atomic_set(&frame->refcount, 1);
+
+		k_mutex_lock(&cc.lock, K_FOREVER);
+		frame->sequence = cc.sequence++;
+		cc.stats.captured++;
+
+		if (cc.mode == CAMERA_CAPTURE_LATEST && cc.ready_count) {
+			stale = cc.ready[cc.ready_head];
+			cc.ready[cc.ready_head] = frame;
+			cc.stats.dropped++;
+		} else {
+			cc.ready[(cc.ready_head + cc.ready_count) % MAX_BUFFERS] = frame;
+			cc.ready_count++;
+			k_sem_give(&cc.ready_sem);
+		}
+		k_mutex_unlock(&cc.lock);
+
+		if (stale) {
+			camera_frame_unref(stale);
+		}
+	}
+}
+
+int camera_capture_init(const struct device *dev, const struct camera_capture_config *cfg)
+{
+	struct video_format fmt = {0};
+	size_t bsize;
+	int ret;
+
+	if (cc.dev) {
+		return -EALREADY;
+	}
+
+	if (!device_is_ready(dev)) {
+		LOG_ERR("%s: device not ready.", dev->name);
+		return -ENODEV;
+	}
+
+	if (cfg->num_buffers == 0 || cfg->num_buffers > MAX_BUFFERS) {
+		LOG_ERR("Unsupported buffer count %u", cfg->num_buffers);
+		return -EINVAL;
+	}
+
+	cc.dev = dev;
+
+	/* With a separate output endpoint the capture format applies to the input */
+	ret = set_format(cfg->out_pixelformat ? VIDEO_EP_IN : VIDEO_EP_OUT, cfg, &fmt);
+	if (ret) {
+		LOG_ERR("Failed to set video format. ret - %d", ret);
+		goto err;
+	}
+
+	if (cfg->out_pixelformat) {
+		fmt.pixelformat = cfg->out_pixelformat;
+		fmt.width = cfg->out_width;
+		fmt.height = cfg->out_height;
+		fmt.pitch = camera_capture_pitch(fmt.pixelformat, fmt.width);
+		log_format("output format", &fmt);
+
+		ret = video_set_format(dev, VIDEO_EP_OUT, &fmt);
+		if (ret) {
+			LOG_ERR("Failed to set video output format. ret - %d", ret);
+			goto err;
+		}
+	}
+
+	bsize = fmt.pitch * fmt.height;
+
+	for (int i = 0; i < cfg->num_buffers; i++) {
+		struct camera_frame *frame = &cc.frames[i];
+
+		frame->vbuf = video_buffer_alloc(bsize, K_NO_WAIT);
+		if (frame->vbuf == NULL) {
+			LOG_ERR("Unable to alloc video buffer");
+			ret = -ENOMEM;
+			goto err;
+		}
+
+		frame->data = frame->vbuf->buffer;
+		frame->width = fmt.width;
+		frame->height = fmt.height;
+		frame->pitch = fmt.pitch;
+		frame->pixelformat = fmt.pixelformat;
+		cc.num_frames++;
+
+		LOG_INF("- addr - %p, size - %zu", (void *)frame->data, bsize);
+	}
+
+	/* Queue only once every buffer is allocated so the error path can free them */
+	for (int i = 0; i < cc.num_frames; i++) {
+		video_enqueue(dev, VIDEO_EP_OUT, cc.frames[i].vbuf);
+	}
+
+	cc.mode = cfg->mode;
+	k_mutex_init(&cc.lock);
+	k_sem_init(&cc.ready_sem, 0, MAX_BUFFERS);
+
+	k_thread_create(&capture_thread, capture_stack, K_THREAD_STACK_SIZEOF(capture_stack),
+			capture_thread_fn, NULL, NULL, NULL, CONFIG_CAMERA_CAPTURE_THREAD_PRIORITY,
+			0, K_NO_WAIT);
+	k_thread_name_set(&capture_thread, "camera_capture");
+
+	return 0;
+
+err:
+	for (int i = 0; i < cc.num_frames; i++) {
+		video_buffer_release(cc.frames[i].vbuf);
+		cc.frames[i].vbuf = NULL;
+	}
+	cc.num_frames = 0;
+	cc.dev = NULL;
+	return ret;
+}
+
+int camera_capture_start(void)
+{
+	int ret;
+
+	cc.streaming = true;
+	ret = video_stream_start(cc.dev);
+	if (ret && ret != -EBUSY) {
+		LOG_ERR("Unable to start capture (interface). ret - %d", ret);
+		cc.streaming = false;
+		return ret;
+	}
+
+	LOG_INF("Capture started");
+	return 0;
+}
+
+int camera_capture_stop(void)
+{
+	/* Released frames are still queued but no longer restart the stream */
+	cc.streaming = false;
+	return video_stream_stop(cc.dev);
+}
+
+struct camera_frame *camera_capture_get(k_timeout_t timeout)
+{
+	struct camera_frame *frame;
+
+	if (k_sem_take(&cc.ready_sem, timeout)) {
+		return NULL;
+	}
+
+	k_mutex_lock(&cc.lock, K_FOREVER);
+	frame = cc.ready[cc.ready_head];
+	cc.ready_head = (cc.ready_head + 1) % MAX_BUFFERS;
+	cc.ready_count--;
+	cc.stats.delivered++;
+	k_mutex_unlock(&cc.lock);
+
+	return frame;
+}
+
+void camera_frame_ref(struct camera_frame *frame)
+{
+	atomic_inc(&frame->refcount);
+}
+
+void camera_frame_unref(struct camera_frame *frame)
+{
+	if (atomic_dec(&frame->refcount) == 1) {
+		recycle(frame);
+	}
+}
+
+uint8_t *camera_frame_writable(struct camera_frame *frame)
+{
+	/* Nobody can take another reference while the caller holds the only one */
+	return atomic_get(&frame->refcount) == 1 ? frame->data : NULL;
+}
+
+void camera_capture_get_stats(struct camera_capture_stats *stats)
+{
+	k_mutex_lock(&cc.lock, K_FOREVER);
+	*stats = cc.stats;
+	k_mutex_unlock(&cc.lock);
+}
@@ -0,0 +1,134 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   camera_capture.h
+ *
+ * Camera capture service. Owns the video buffer pool of one video device,
+ * dequeues frames in a dedicated thread, stamps them and hands them out
+ * without copying. A frame is returned to the driver once every holder has
+ * dropped its reference.
+ */
+#ifndef __CAMERA_CAPTURE_H
+#define __CAMERA_CAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/video.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum camera_capture_mode {
+	/* Keep only the newest frame; an older frame nobody took is recycled. */
+	CAMERA_CAPTURE_LATEST,
+	/* Deliver every frame in order; the camera stalls if nobody consumes. */
+	CAMERA_CAPTURE_FIFO,
+};
+
+struct camera_capture_config {
+	/* Capture format; width/height of 0 select the smallest size supported. */
+	uint32_t pixelformat;
+	uint16_t width;
+	uint16_t height;
+	/*
+	 * Output format for devices with separate input and output endpoints,
+	 * e.g. the ISP. Leave out_pixelformat at 0 for a plain camera.
+	 */
+	uint32_t out_pixelformat;
+	uint16_t out_width;
+	uint16_t out_height;
+	/* Buffers to allocate, 1..CONFIG_CAMERA_CAPTURE_MAX_BUFFERS. */
+	uint8_t num_buffers;
+	enum camera_capture_mode mode;
+};
+
+struct camera_frame {
+	struct video_buffer *vbuf;
+	uint8_t *data;
+	size_t size;
+	uint16_t width;
+	uint16_t height;
+	uint32_t pitch;
+	uint32_t pixelformat;
+	/* Incremented for every frame received from the driver. */
+	uint32_t sequence;
+	/* System uptime when the capture thread dequeued the frame. */
+	int64_t timestamp_us;
+	/* Driver timestamp in milliseconds, see struct video_buffer. */
+	uint32_t hw_timestamp_ms;
+	atomic_t refcount;
+};
+
+struct camera_capture_stats {
+	/* Frames received from the driver. */
+	uint32_t captured;
+	/* Frames recycled in CAMERA_CAPTURE_LATEST mode without being taken. */
+	uint32_t dropped;
+	/* Frames handed out by camera_capture_get(). */
+	uint32_t delivered;
+};
+
+/**
+ * @brief Configure the device, allocate and queue the capture buffers.
+ *
+ * @param dev Video device, camera or ISP.
+ * @param cfg Formats, buffer count and delivery mode.
+ *
+ * @retval 0 on success.
+ * @retval -ENODEV if the device is not ready.
+ * @retval -ENOTSUP if the pixel format is not supported.
+ * @retval -EINVAL if the buffer count is out of range.
+ * @retval -ENOMEM if the buffers could not be allocated.
+ * @retval -EALREADY if the service is already initialised.
+ */
+int camera_capture_init(const struct device *dev, const struct camera_capture_config *cfg);
+
+int camera_capture_start(void);
+int camera_capture_stop(void);
+
+/**
+ * @brief Take the next frame.
+ *
+ * The caller owns one reference and must release it with
+ * camera_frame_unref(). Further consumers take their own reference with
+ * camera_frame_ref() before the frame is passed on.
+ *
+ * @return Frame, or NULL if none arrived within @p timeout.
+ */
+struct camera_frame *camera_capture_get(k_timeout_t timeout);
+
+void camera_frame_ref(struct camera_frame *frame);
+
+/* Drop a reference; the last one queues the buffer back to the driver. */
+void camera_frame_unref(struct camera_frame *frame);
+
+/**
+ * @brief Frame data for in-place processing.
+ *
+ * Frames are shared between consumers, so only the sole holder may modify
+ * the data, e.g. unpack RAW10 in place.
+ *
+ * @return frame->data, or NULL if another reference exists.
+ */
+uint8_t *camera_frame_writable(struct camera_frame *frame);
+
+void camera_capture_get_stats(struct camera_capture_stats *stats);
+
+/* Bytes per line for a video pixel format. */
+uint32_t camera_capture_pitch(uint32_t pixelformat, uint32_t width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CAMERA_CAPTURE_H */
@@ -8,13 +8,20 @@
  *
  */
 
+#include <string.h>
+#include <zephyr/cache.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/display.h>
 #include <zephyr/drivers/display/cdc200.h>
 #include <zephyr/drivers/mipi_dsi/dsi_dw.h>
+#include <zephyr/irq.h>
 #include <zephyr/logging/log.h>
 #include "display.h"
 
+#if defined(CONFIG_DAVE2D)
+#include "dave2d.h"
+#endif
+
 LOG_MODULE_REGISTER(display_app, LOG_LEVEL_DBG);
 
 #define DISPLAY_NODE DT_CHOSEN(zephyr_display)
@@ -22,7 +29,37 @@ LOG_MODULE_REGISTER(display_app, LOG_LEVEL_DBG);
 #define DISPLAY_WIDTH  DT_PROP(DISPLAY_NODE, width)
 #define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
 
-#define BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT * 2)
+#if defined(CONFIG_DBUF_DISPLAY_FORMAT_ARGB8888)
+#define DEFAULT_FORMAT      DISPLAY_FB_ARGB8888
+#define MAX_BYTES_PER_PIXEL 4
+#elif defined(CONFIG_DBUF_DISPLAY_FORMAT_RGB888)
+#define DEFAULT_FORMAT      DISPLAY_FB_RGB888
+#define MAX_BYTES_PER_PIXEL 3
+#elif defined(CONFIG_DBUF_DISPLAY_FORMAT_ARGB4444)
+#define DEFAULT_FORMAT      DISPLAY_FB_ARGB4444
+#define MAX_BYTES_PER_PIXEL 2
+#elif defined(CONFIG_DBUF_DISPLAY_FORMAT_L8)
+#define DEFAULT_FORMAT      DISPLAY_FB_L8
+#define MAX_BYTES_PER_PIXEL 1
+#else
+#define DEFAULT_FORMAT      DISPLAY_FB_RGB565
+#define MAX_BYTES_PER_PIXEL 2
+#endif
+
+static const uint8_t format_bpp[] = {
+	[DISPLAY_FB_RGB565] = 2,
+	[DISPLAY_FB_ARGB8888] = 4,
+	[DISPLAY_FB_RGB888] = 3,
+	[DISPLAY_FB_ARGB4444] = 2,
+	[DISPLAY_FB_L8] = 1,
+};
+
+#define BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_HEIGHT * MAX_BYTES_PER_PIXEL)
+
+static enum display_fb_format fb_format = DEFAULT_FORMAT;
+static uint32_t bpp = MAX_BYTES_PER_PIXEL;
+static uint32_t pitch = DISPLAY_WIDTH * MAX_BYTES_PER_PIXEL;
+static bool initialized;
 
 #ifdef CONFIG_DBUF_DISPLAY_SECTION
 #define DBUF_DISPLAY_ATTRS __attribute__((section(CONFIG_DBUF_DISPLAY_SECTION)))
@@ -30,23 +67,215 @@ LOG_MODULE_REGISTER(display_app, LOG_LEVEL_DBG);
 #define DBUF_DISPLAY_ATTRS
 #endif
 
-uint8_t DBUF_DISPLAY_ATTRS buf0[BUFFER_SIZE];
-uint8_t DBUF_DISPLAY_ATTRS buf1[BUFFER_SIZE];
+#define NUM_BUFFERS CONFIG_DBUF_DISPLAY_NUM_BUFFERS
+
+static uint8_t DBUF_DISPLAY_ATTRS buffers[NUM_BUFFERS][BUFFER_SIZE];
+
+enum buffer_state {
+	BUFFER_FREE,
+	BUFFER_ACQUIRED,
+	BUFFER_QUEUED,
+	BUFFER_FRONT,
+};
+
+#define MAX_RECTS CONFIG_DBUF_DISPLAY_MAX_DAMAGE_RECTS
 
-enum {
-	BUFFER_1 = 0,
-	BUFFER_2 = 1,
-	NUM_BUFFERS
+/* An empty list means the whole frame */
+struct damage {
+	uint8_t count;
+	struct display_rect rects[MAX_RECTS];
 };
 
-static uint8_t *buffers[NUM_BUFFERS] = {buf0, buf1};
+struct frame {
+	enum buffer_state state;
+	uint32_t duration_ms;
+	uint32_t fence;
+	/* Regions drawn since the buffer was acquired */
+	struct damage drawn;
+	/* Regions presented in other buffers since this one was last up to date */
+	struct damage stale;
+	bool stale_full;
+};
+
+static struct frame frames[NUM_BUFFERS];
+
+/* Presentation queue, oldest first */
+static uint8_t queue[NUM_BUFFERS];
+static uint8_t queue_head;
+static uint8_t queue_count;
+
+static uint8_t front;
+static uint32_t front_cycles;
+static uint32_t next_fence = 1;
+static uint32_t displayed_fence;
+static uint32_t last_presented = NUM_BUFFERS;
+
+static void blit_rect_cpu(void *dst, const void *src, uint32_t stride,
+			  const struct display_rect *rect);
+
+static display_blit_t blit = blit_rect_cpu;
+
+/* Back buffer used by display_inactive_buffer() and display_next_frame() */
+static void *legacy_back;
+
+static struct display_stats stats;
+static uint64_t interval_sum_us;
+
+static K_MUTEX_DEFINE(lock);
+static K_CONDVAR_DEFINE(fence_cv);
+static K_SEM_DEFINE(free_sem, NUM_BUFFERS - 1, NUM_BUFFERS - 1);
+static K_SEM_DEFINE(vsync_sem, 0, 1);
+
+static void flip_thread_fn(void *p1, void *p2, void *p3);
+
+K_THREAD_DEFINE(dbuf_display_flip, CONFIG_DBUF_DISPLAY_FLIP_THREAD_STACK_SIZE, flip_thread_fn,
+		NULL, NULL, NULL, CONFIG_DBUF_DISPLAY_FLIP_THREAD_PRIORITY, 0, SYS_FOREVER_MS);
+
+#if defined(CONFIG_DBUF_DISPLAY_VSYNC_LINE_IRQ)
+#if !DT_IRQ_HAS_NAME(DISPLAY_NODE, scanline_0)
+#error "zephyr,display has no scanline_0 interrupt, select CONFIG_DBUF_DISPLAY_VSYNC_TIMER"
+#endif
+
+#define CDC_BASE              DT_REG_ADDR(DISPLAY_NODE)
+#define CDC_LINE_IRQ          DT_IRQ_BY_NAME(DISPLAY_NODE, scanline_0, irq)
+
+/* CDC200 global registers */
+#define CDC_ACTW_CFG          (CDC_BASE + 0x10)
+#define CDC_IRQ_MASK0         (CDC_BASE + 0x34)
+#define CDC_IRQ_STATUS0       (CDC_BASE + 0x38)
+#define CDC_IRQ_CLEAR0        (CDC_BASE + 0x3c)
+#define CDC_LINE_IRQ0_POS     (CDC_BASE + 0x40)
+#define CDC_IRQ_LINE          BIT(0)
+#define CDC_ACTW_HEIGHT_MASK  0xffff
+
+static void line_irq_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	if (sys_read32(CDC_IRQ_STATUS0) & CDC_IRQ_LINE) {
+		sys_write32(CDC_IRQ_LINE, CDC_IRQ_CLEAR0);
+		display_vsync_notify();
+	}
+}
+
+static void vsync_start(void)
+{
+	/* The accumulated active height is the last active line, fire on the next */
+	uint32_t line = (sys_read32(CDC_ACTW_CFG) & CDC_ACTW_HEIGHT_MASK) + 1;
+
+	IRQ_CONNECT(CDC_LINE_IRQ, CONFIG_DBUF_DISPLAY_VSYNC_IRQ_PRIORITY, line_irq_isr, NULL, 0);
+	sys_write32(line, CDC_LINE_IRQ0_POS);
+	sys_write32(CDC_IRQ_LINE, CDC_IRQ_CLEAR0);
+	sys_write32(sys_read32(CDC_IRQ_MASK0) | CDC_IRQ_LINE, CDC_IRQ_MASK0);
+	irq_enable(CDC_LINE_IRQ);
+}
+#elif defined(CONFIG_DBUF_DISPLAY_VSYNC_TIMER)
+static void vsync_timer_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+	display_vsync_notify();
+}
+
+static K_TIMER_DEFINE(vsync_timer, vsync_timer_fn, NULL);
 
-static uint8_t current_buffer = BUFFER_1;
-static uint32_t frame_durations[NUM_BUFFERS] = {1, 1};
-static uint32_t switch_times[NUM_BUFFERS] = {0, 0};
+static void vsync_start(void)
+{
+	k_timer_start(&vsync_timer, K_USEC(USEC_PER_SEC / CONFIG_DBUF_DISPLAY_REFRESH_RATE),
+		      K_USEC(USEC_PER_SEC / CONFIG_DBUF_DISPLAY_REFRESH_RATE));
+}
+#else
+static void vsync_start(void)
+{
+}
+#endif
 
 static const struct device *display_dev = DEVICE_DT_GET(DISPLAY_NODE);
 
+int display_set_format(enum display_fb_format format)
+{
+	if (initialized) {
+		return -EBUSY;
+	}
+	if ((unsigned int)format >= ARRAY_SIZE(format_bpp) ||
+	    format_bpp[format] > MAX_BYTES_PER_PIXEL) {
+		return -EINVAL;
+	}
+
+	fb_format = format;
+	bpp = format_bpp[format];
+	pitch = DISPLAY_WIDTH * bpp;
+	return 0;
+}
+
+enum display_fb_format display_format(void)
+{
+	return fb_format;
+}
+
+#if defined(CONFIG_DAVE2D)
+int display_d2_mode(void)
+{
+	switch (fb_format) {
+	case DISPLAY_FB_RGB565:
+		return d2_mode_rgb565;
+	case DISPLAY_FB_ARGB8888:
+		return d2_mode_argb8888;
+	case DISPLAY_FB_RGB888:
+		return d2_mode_rgb888;
+	case DISPLAY_FB_ARGB4444:
+		return d2_mode_argb4444;
+	default:
+		/* D/AVE2D has no luminance render target */
+		return -ENOTSUP;
+	}
+}
+#endif
+
+uint32_t display_bytes_per_pixel(void)
+{
+	return bpp;
+}
+
+uint32_t display_pitch(void)
+{
+	return pitch;
+}
+
+/* Make the controller scan out in fb_format, converting to the panel format itself */
+static int set_controller_format(void)
+{
+	struct display_capabilities caps;
+	enum display_pixel_format pf;
+	int ret;
+
+	switch (fb_format) {
+	case DISPLAY_FB_RGB565:
+		pf = PIXEL_FORMAT_RGB_565;
+		break;
+	case DISPLAY_FB_ARGB8888:
+		pf = PIXEL_FORMAT_ARGB_8888;
+		break;
+	case DISPLAY_FB_RGB888:
+		pf = PIXEL_FORMAT_RGB_888;
+		break;
+	default:
+		/* No display_pixel_format equivalent; the layer format comes from devicetree */
+		LOG_INF("Frame buffer format %d taken from the devicetree layer setup", fb_format);
+		return 0;
+	}
+
+	display_get_capabilities(display_dev, &caps);
+	if (caps.current_pixel_format == pf) {
+		return 0;
+	}
+
+	ret = display_set_pixel_format(display_dev, pf);
+	if (ret) {
+		LOG_ERR("Display controller cannot scan out pixel format %d", fb_format);
+	}
+	return ret;
+}
+
 /* Main Display Initialization Function */
 int display_init(void)
 {
@@ -76,46 +305,379 @@ int display_init(void)
 		return ret;
 	}
 
+	ret = set_controller_format();
+	if (ret) {
+		return ret;
+	}
+
 	cdc200_set_enable(display_dev, true);
 
+	frames[front].state = BUFFER_FRONT;
+	initialized = true;
+	k_thread_start(dbuf_display_flip);
+	vsync_start();
+
 	return 0;
 }
 
-void display_set_next_frame_duration(uint32_t duration)
+static void damage_add(struct damage *d, const struct display_rect *r)
 {
-	frame_durations[current_buffer] = duration;
+	for (int i = 0; i < d->count; i++) {
+		const struct display_rect *o = &d->rects[i];
+
+		if (r->x >= o->x && r->y >= o->y && r->x + r->w <= o->x + o->w &&
+		    r->y + r->h <= o->y + o->h) {
+			return;
+		}
+	}
+
+	if (d->count < MAX_RECTS) {
+		d->rects[d->count++] = *r;
+		return;
+	}
+
+	/* Out of slots: collapse everything into the bounding box */
+	struct display_rect *b = &d->rects[0];
+	uint16_t x1 = MAX(b->x + b->w, r->x + r->w);
+	uint16_t y1 = MAX(b->y + b->h, r->y + r->h);
+
+	for (int i = 1; i < d->count; i++) {
+		x1 = MAX(x1, d->rects[i].x + d->rects[i].w);
+		y1 = MAX(y1, d->rects[i].y + d->rects[i].h);
+		b->x = MIN(b->x, d->rects[i].x);
+		b->y = MIN(b->y, d->rects[i].y);
+	}
+	b->x = MIN(b->x, r->x);
+	b->y = MIN(b->y, r->y);
+	b->w = x1 - b->x;
+	b->h = y1 - b->y;
+	d->count = 1;
 }
 
-void display_next_frame(void)
+static const struct display_rect full_rect = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
+
+static void blit_rect_cpu(void *dst, const void *src, uint32_t stride,
+			  const struct display_rect *rect)
+{
+	size_t offset = rect->y * stride + rect->x * bpp;
+	size_t span = (rect->h - 1) * stride + rect->w * bpp;
+	const uint8_t *s = (const uint8_t *)src + offset;
+	uint8_t *d = (uint8_t *)dst + offset;
+
+	/* Either buffer may have been rendered by the GPU */
+	sys_cache_data_flush_and_invd_range((void *)s, span);
+	sys_cache_data_flush_and_invd_range(d, span);
+
+	for (uint16_t y = 0; y < rect->h; y++) {
+		memcpy(d + y * stride, s + y * stride, rect->w * bpp);
+	}
+
+	sys_cache_data_flush_range(d, span);
+}
+
+void display_set_blit(display_blit_t fn)
+{
+	blit = fn ? fn : blit_rect_cpu;
+}
+
+static int buffer_index(const void *buf)
+{
+	for (int i = 0; i < NUM_BUFFERS; i++) {
+		if (buf == buffers[i]) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+int display_damage(void *buf, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	int idx = buffer_index(buf);
+
+	if (idx < 0 || frames[idx].state != BUFFER_ACQUIRED) {
+		return -EINVAL;
+	}
+	if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || w == 0 || h == 0) {
+		return 0;
+	}
+
+	struct display_rect r = {x, y, MIN(w, DISPLAY_WIDTH - x), MIN(h, DISPLAY_HEIGHT - y)};
+
+	damage_add(&frames[idx].drawn, &r);
+	return 0;
+}
+
+void display_vsync_notify(void)
+{
+	k_sem_give(&vsync_sem);
+}
+
+static void update_interval_stats(uint32_t interval_us)
+{
+	/* The first interval is measured on the second flip */
+	if (stats.displayed == 2 || interval_us < stats.interval_min_us) {
+		stats.interval_min_us = interval_us;
+	}
+	if (interval_us > stats.interval_max_us) {
+		stats.interval_max_us = interval_us;
+	}
+	interval_sum_us += interval_us;
+	stats.interval_avg_us = interval_sum_us / (stats.displayed - 1);
+}
+
+/*
+ * Called after each vsync: pick the next queued frame once the frame on the
+ * panel has been shown for its duration. Returns the buffer index to flip to,
+ * or -1 if the panel keeps showing the current frame.
+ */
+static int next_flip(uint32_t now)
 {
-	uint32_t switch_time = switch_times[current_buffer];
+	uint32_t shown_ms = k_cyc_to_ms_floor32(now - front_cycles);
+	int next;
+
+	stats.vsyncs++;
 
-	uint32_t current_frame_time = k_cyc_to_ms_floor32(k_cycle_get_32() - switch_time);
+	if (shown_ms < frames[front].duration_ms) {
+		return -1;
+	}
 
-	if (current_frame_time < frame_durations[current_buffer]) {
-		k_sleep(K_MSEC(frame_durations[current_buffer] - current_frame_time));
+	if (queue_count == 0) {
+		if (stats.presented) {
+			stats.missed++;
+		}
+		return -1;
 	}
 
-	current_buffer = (current_buffer + 1) % NUM_BUFFERS;
+	next = queue[queue_head];
+	queue_head = (queue_head + 1) % NUM_BUFFERS;
+	queue_count--;
+	return next;
+}
+
+static void flip_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		uint32_t now;
+		int next;
+
+		k_sem_take(&vsync_sem, K_FOREVER);
 
-	struct display_buffer_descriptor desc = {.buf_size = BUFFER_SIZE,
-						 .width = DISPLAY_WIDTH,
-						 .height = DISPLAY_HEIGHT,
-						 .pitch = DISPLAY_WIDTH};
+		now = k_cycle_get_32();
+		k_mutex_lock(&lock, K_FOREVER);
+		next = next_flip(now);
+		k_mutex_unlock(&lock);
 
-	display_write(display_dev, 0, 0, &desc, buffers[current_buffer]);
+		if (next < 0) {
+			continue;
+		}
 
-	switch_times[current_buffer] = k_cycle_get_32();
+		/*
+		 * The controller scans out whatever buffer it is given, so flip to
+		 * the whole frame; acquire() already made it complete.
+		 */
+		struct display_buffer_descriptor desc = {
+			.buf_size = DISPLAY_HEIGHT * pitch,
+			.width = DISPLAY_WIDTH,
+			.height = DISPLAY_HEIGHT,
+			.pitch = DISPLAY_WIDTH,
+		};
+
+		display_write(display_dev, 0, 0, &desc, buffers[next]);
+
+		k_mutex_lock(&lock, K_FOREVER);
+		/* The previous front buffer is no longer scanned out */
+		frames[front].state = BUFFER_FREE;
+		frames[next].state = BUFFER_FRONT;
+		stats.displayed++;
+		if (stats.displayed > 1) {
+			update_interval_stats(k_cyc_to_us_floor32(now - front_cycles));
+		}
+		front = next;
+		front_cycles = now;
+		displayed_fence = frames[next].fence;
+		k_condvar_broadcast(&fence_cv);
+		k_mutex_unlock(&lock);
+
+		k_sem_give(&free_sem);
+	}
+}
+
+static void *acquire(k_timeout_t timeout, bool preserve)
+{
+	struct frame *f = NULL;
+	struct damage stale;
+	bool stale_full = false;
+	int src = NUM_BUFFERS;
+	uint32_t pixels = 0;
+	int idx;
+
+	if (k_sem_take(&free_sem, timeout)) {
+		return NULL;
+	}
+
+	/*
+	 * Take over the stale list in the same locked section that picks the
+	 * source frame. Damage a concurrent display_present() adds during the
+	 * copy below stays on the list for the next acquire.
+	 */
+	k_mutex_lock(&lock, K_FOREVER);
+	for (idx = 0; idx < NUM_BUFFERS; idx++) {
+		if (frames[idx].state == BUFFER_FREE) {
+			f = &frames[idx];
+			f->state = BUFFER_ACQUIRED;
+			src = last_presented;
+			stale = f->stale;
+			stale_full = f->stale_full;
+			f->stale.count = 0;
+			f->stale_full = false;
+			f->drawn.count = 0;
+			break;
+		}
+	}
+	k_mutex_unlock(&lock);
+
+	if (f == NULL) {
+		return NULL;
+	}
+
+	/*
+	 * Bring the buffer up to date with the newest presented frame. That
+	 * frame is queued or on the panel, so it is not written while we read.
+	 */
+	if (preserve && src < NUM_BUFFERS && (stale_full || stale.count)) {
+		const struct display_rect *rects = stale_full ? &full_rect : stale.rects;
+		int count = stale_full ? 1 : stale.count;
+
+		for (int i = 0; i < count; i++) {
+			blit(buffers[idx], buffers[src], pitch, &rects[i]);
+			pixels += rects[i].w * rects[i].h;
+		}
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+	stats.pixels_copied += pixels;
+	k_mutex_unlock(&lock);
+
+	return buffers[idx];
+}
+
+void *display_acquire(k_timeout_t timeout)
+{
+	return acquire(timeout, true);
+}
+
+int display_present(void *buf, uint32_t duration_ms, uint32_t *fence)
+{
+	int idx = buffer_index(buf);
+
+	k_mutex_lock(&lock, K_FOREVER);
+	if (idx < 0 || frames[idx].state != BUFFER_ACQUIRED) {
+		k_mutex_unlock(&lock);
+		return -EINVAL;
+	}
+
+	/* Every other buffer now lags behind by what was drawn into this one */
+	for (int i = 0; i < NUM_BUFFERS; i++) {
+		struct frame *other = &frames[i];
+
+		if (i == idx || other->stale_full) {
+			continue;
+		}
+		if (frames[idx].drawn.count == 0) {
+			other->stale_full = true;
+			continue;
+		}
+		for (int r = 0; r < frames[idx].drawn.count; r++) {
+			damage_add(&other->stale, &frames[idx].drawn.rects[r]);
+		}
+	}
+
+	frames[idx].state = BUFFER_QUEUED;
+	frames[idx].duration_ms = duration_ms;
+	frames[idx].fence = next_fence++;
+	queue[(queue_head + queue_count) % NUM_BUFFERS] = idx;
+	queue_count++;
+	last_presented = idx;
+	stats.presented++;
+
+	if (fence) {
+		*fence = frames[idx].fence;
+	}
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
+bool display_fence_signaled(uint32_t fence)
+{
+	/* Fences are handed out in order; compare with wrap-around */
+	return (int32_t)(displayed_fence - fence) >= 0;
+}
+
+int display_fence_wait(uint32_t fence, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret = 0;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	while (!display_fence_signaled(fence)) {
+		ret = k_condvar_wait(&fence_cv, &lock, sys_timepoint_timeout(end));
+		if (ret) {
+			break;
+		}
+	}
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+void display_get_stats(struct display_stats *out)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	*out = stats;
+	k_mutex_unlock(&lock);
+}
+
+void display_reset_stats(void)
+{
+	k_mutex_lock(&lock, K_FOREVER);
+	stats = (struct display_stats){0};
+	interval_sum_us = 0;
+	k_mutex_unlock(&lock);
+}
+
+void display_set_next_frame_duration(uint32_t duration)
+{
+	/* Applies to the frame presented last, whether still queued or on the panel */
+	k_mutex_lock(&lock, K_FOREVER);
+	if (last_presented < NUM_BUFFERS) {
+		frames[last_presented].duration_ms = duration;
+	}
+	k_mutex_unlock(&lock);
+}
+
+void display_next_frame(void)
+{
+	display_present(display_inactive_buffer(), 0, NULL);
+	legacy_back = NULL;
 }
 
 void *display_active_buffer(void)
 {
-	return buffers[current_buffer];
+	return buffers[front];
 }
 
 void *display_inactive_buffer(void)
 {
-	return buffers[(current_buffer + 1) % NUM_BUFFERS];
+	if (legacy_back == NULL) {
+		/* Callers of the single back buffer API redraw the whole frame */
+		legacy_back = acquire(K_FOREVER, false);
+	}
+	return legacy_back;
 }
 
 uint32_t display_width(void)
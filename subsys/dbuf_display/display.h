@@ -14,6 +14,7 @@
 #ifndef __DISPLAY_H
 #define __DISPLAY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <zephyr/kernel.h>
 
@@ -22,7 +23,93 @@
 #define DISPLAY_WIDTH  DT_PROP(DISPLAY_NODE, width)
 #define DISPLAY_HEIGHT DT_PROP(DISPLAY_NODE, height)
 
+enum display_fb_format {
+	DISPLAY_FB_RGB565,
+	DISPLAY_FB_ARGB8888,
+	DISPLAY_FB_RGB888,
+	DISPLAY_FB_ARGB4444,
+	DISPLAY_FB_L8,
+};
+
+struct display_rect {
+	uint16_t x;
+	uint16_t y;
+	uint16_t w;
+	uint16_t h;
+};
+
+/* Copies one rectangle between two frame buffers of the given pitch in bytes. */
+typedef void (*display_blit_t)(void *dst, const void *src, uint32_t pitch,
+			       const struct display_rect *rect);
+
+struct display_stats {
+	/* Frames queued with display_present() */
+	uint32_t presented;
+	/* Frames flipped onto the panel */
+	uint32_t displayed;
+	uint32_t vsyncs;
+	/* Vsyncs at which the frame on the panel had expired but no new frame was queued */
+	uint32_t missed;
+	/* Time between flips */
+	uint32_t interval_min_us;
+	uint32_t interval_max_us;
+	uint32_t interval_avg_us;
+	/* Pixels copied to bring acquired buffers up to date with the newest frame */
+	uint64_t pixels_copied;
+};
+
 int display_init(void);
+
+/*
+ * Pick the frame buffer format; only before display_init() and only formats
+ * no wider than CONFIG_DBUF_DISPLAY_FORMAT, which the buffers are sized for.
+ */
+int display_set_format(enum display_fb_format format);
+enum display_fb_format display_format(void);
+#if defined(CONFIG_DAVE2D)
+/*
+ * D/AVE2D d2_framebuffer() mode for the frame buffer format, -ENOTSUP for
+ * formats D/AVE2D cannot render to (L8).
+ */
+int display_d2_mode(void);
+#endif
+uint32_t display_bytes_per_pixel(void);
+/* Bytes from one line of a frame buffer to the next */
+uint32_t display_pitch(void);
+
+/*
+ * Swap chain API. display_acquire() hands out a free back buffer holding
+ * the newest presented frame, display_present() queues it for the next
+ * vsync and returns at once.
+ * The fence identifies the presented frame; it is signalled when the
+ * frame reaches the panel.
+ */
+void *display_acquire(k_timeout_t timeout);
+int display_present(void *buf, uint32_t duration_ms, uint32_t *fence);
+bool display_fence_signaled(uint32_t fence);
+int display_fence_wait(uint32_t fence, k_timeout_t timeout);
+
+/*
+ * Mark a region of an acquired buffer as drawn. Only marked regions are copied
+ * into the other buffers when they are next acquired; the panel always scans
+ * out whole buffers. A frame presented without any marked region is treated
+ * as fully redrawn. Buffers are expected to be drawn by a single thread.
+ */
+int display_damage(void *buf, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/*
+ * Replace the CPU copy used to bring a newly acquired buffer up to date,
+ * e.g. with a D/AVE2D blit. NULL restores the CPU copy.
+ */
+void display_set_blit(display_blit_t blit);
+
+/* Called on every vertical blank; ISR safe. */
+void display_vsync_notify(void);
+
+void display_get_stats(struct display_stats *stats);
+void display_reset_stats(void);
+
+/* Single back buffer API, built on the swap chain. */
 void display_set_next_frame_duration(uint32_t duration);
 void display_next_frame(void);
 void *display_active_buffer(void);
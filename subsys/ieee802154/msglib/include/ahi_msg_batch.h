@@ -0,0 +1,94 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/*
+ * Batched AHI command submission.
+ *
+ * Commands built with the alif_ahi_msg_* builders are appended to a batch,
+ * which concatenates them into one buffer sent to the transport in a single
+ * write. The completion events are then fed back one by one and matched to
+ * their command by response code and context (the ctx given to the
+ * builder), so the caller waits once for the whole batch instead of once
+ * per command. Commands pending in the same batch must not share both
+ * response code and context.
+ */
+
+#ifndef AHI_MSG_BATCH_H_
+#define AHI_MSG_BATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ahi_msg_lib.h"
+#include "ahi_msg_view.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ahi_msg_batch_entry {
+	/* Expected response, copied from the builder's msg_buf */
+	uint16_t rsp_event;
+	uint16_t rsp_msg;
+	uint16_t ctx;
+	bool done;
+	enum alif_mac154_status_code status;
+	/* Whole response, only held when it was received as a view */
+	struct ahi_msg_view resp;
+};
+
+struct ahi_msg_batch {
+	uint8_t buf[CONFIG_IEEE802154_ALIF_AHI_MSG_BATCH_BUF_SIZE];
+	uint16_t len;
+	uint8_t count;
+	uint8_t pending;
+	struct ahi_msg_batch_entry entry[CONFIG_IEEE802154_ALIF_AHI_MSG_BATCH_MAX_CMDS];
+};
+
+void alif_ahi_msg_batch_init(struct ahi_msg_batch *p_batch);
+
+/**
+ * @brief Append a built command to a batch.
+ *
+ * @return Index of the command in the batch.
+ * @retval -EINVAL if @p p_msg does not hold a command.
+ * @retval -ENOMEM if the batch is full.
+ * @retval -EALREADY if a pending command expects the same response and context.
+ */
+int alif_ahi_msg_batch_add(struct ahi_msg_batch *p_batch, const struct msg_buf *p_msg);
+
+/* Commands of the batch, to be written to the transport in one go. */
+const uint8_t *alif_ahi_msg_batch_data(const struct ahi_msg_batch *p_batch, uint16_t *p_len);
+
+/**
+ * @brief Match a received message against the pending commands of a batch.
+ *
+ * The status of a completion event is stored in the matching entry.
+ *
+ * @return Index of the completed command.
+ * @retval -ENOENT if the message does not complete a pending command.
+ */
+int alif_ahi_msg_batch_resp_event_recv(struct ahi_msg_batch *p_batch,
+				       const struct msg_buf *p_src_msg);
+
+/* As alif_ahi_msg_batch_resp_event_recv(), the entry keeps a reference to the view. */
+int alif_ahi_msg_batch_view_resp_recv(struct ahi_msg_batch *p_batch,
+				      const struct ahi_msg_view *p_view);
+
+/* True once every command of the batch has completed. */
+bool alif_ahi_msg_batch_done(const struct ahi_msg_batch *p_batch);
+
+/* Drop the responses held by a batch and empty it for reuse. */
+void alif_ahi_msg_batch_release(struct ahi_msg_batch *p_batch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AHI_MSG_BATCH_H_ */
@@ -0,0 +1,133 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/*
+ * Zero-copy receive path for AHI messages.
+ *
+ * The transport wraps every receive buffer in a struct ahi_msg_rx_buf and
+ * hands out views of the messages it holds. A view only points into the
+ * buffer and keeps a reference on it; the buffer is given back to the
+ * transport through its release callback once the transport and every
+ * holder of a view have dropped their reference. Parsers read the message
+ * in place, and an RX frame is returned as a pointer into the buffer, so a
+ * frame travels from the transport to the upper layer without being copied.
+ */
+
+#ifndef AHI_MSG_VIEW_H_
+#define AHI_MSG_VIEW_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/atomic.h>
+
+#include "ahi_msg_lib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ahi_msg_rx_buf;
+
+typedef void (*ahi_msg_rx_buf_release_t)(struct ahi_msg_rx_buf *p_buf);
+
+struct ahi_msg_rx_buf {
+	/* Received bytes, one or more complete AHI messages */
+	const uint8_t *data;
+	uint16_t len;
+	atomic_t ref;
+	/* Called when the last reference is dropped */
+	ahi_msg_rx_buf_release_t release;
+	void *user_data;
+};
+
+struct ahi_msg_view {
+	/* Whole message including the transport header */
+	const uint8_t *msg;
+	uint16_t msg_len;
+	struct ahi_msg_rx_buf *p_buf;
+};
+
+/* Received frame, data points into the receive buffer of the view */
+struct alif_ahi_msg_rx_frame {
+	uint16_t ctx;
+	int8_t rssi;
+	bool frame_pending;
+	uint64_t timestamp;
+	uint8_t len;
+	const uint8_t *data;
+	bool ack_sec;
+	uint32_t ack_fc;
+	uint8_t ack_key_idx;
+};
+
+/**
+ * @brief Take ownership of a receive buffer.
+ *
+ * The buffer starts with one reference held by the caller, dropped with
+ * alif_ahi_msg_rx_buf_unref() once the transport is done handing out views.
+ */
+void alif_ahi_msg_rx_buf_init(struct ahi_msg_rx_buf *p_buf, const uint8_t *data, uint16_t len,
+			      ahi_msg_rx_buf_release_t release, void *user_data);
+
+void alif_ahi_msg_rx_buf_unref(struct ahi_msg_rx_buf *p_buf);
+
+/**
+ * @brief Get a view of the message starting at @p offset in a receive buffer.
+ *
+ * A reference is taken only when a complete message is found.
+ *
+ * @return 1 and a referenced view if the message is complete, 0 if more data
+ *         is needed, negative if the data is not a valid AHI message (same
+ *         values as alif_ahi_msg_valid_message()).
+ */
+int alif_ahi_msg_view_get(struct ahi_msg_rx_buf *p_buf, uint16_t offset,
+			  struct ahi_msg_view *p_view);
+
+/* Copy a view, taking another reference on its buffer. */
+void alif_ahi_msg_view_ref(const struct ahi_msg_view *p_view, struct ahi_msg_view *p_copy);
+
+/* Drop the reference held by a view, the view is cleared. */
+void alif_ahi_msg_view_release(struct ahi_msg_view *p_view);
+
+/**
+ * @brief Match a view against an awaited response, without copying it.
+ *
+ * Same rules as alif_ahi_msg_resp_event_recv(). On a match @p p_resp gets its
+ * own reference to the message, to be released by the waiter once parsed.
+ */
+bool alif_ahi_msg_view_resp_event_recv(const struct msg_buf *p_dest_msg,
+				       const struct ahi_msg_view *p_view,
+				       struct ahi_msg_view *p_resp);
+
+/* Parse an RX frame indication (v1.1.0 layout) in place. */
+bool alif_ahi_msg_view_recv_ind(const struct ahi_msg_view *p_view,
+				struct alif_ahi_msg_rx_frame *p_frame);
+
+/* Parse a generic command complete event in place. */
+enum alif_mac154_status_code alif_ahi_msg_view_status(const struct ahi_msg_view *p_view,
+						      uint8_t *p_ctx);
+
+/**
+ * @brief Parse a TX complete event (v1.1.0 layout) in place.
+ *
+ * @p p_ack is set to the ACK frame inside the receive buffer, valid as long
+ * as the view is held.
+ */
+enum alif_mac154_status_code alif_ahi_msg_view_tx_start_resp(const struct ahi_msg_view *p_view,
+							     uint8_t *p_ctx, int8_t *p_rssi,
+							     uint64_t *p_timestamp,
+							     const uint8_t **p_ack,
+							     uint8_t *p_ack_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AHI_MSG_VIEW_H_ */
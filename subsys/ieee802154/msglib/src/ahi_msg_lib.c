@@ -7,6 +7,7 @@
  * contact@alifsemi.com, or visit: https://alifsemi.com/license
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -23,6 +24,8 @@ struct __attribute__((packed, aligned(1))) T_UINT32_READ {
 #include "mac154_err.h"
 
 #include "ahi_msg_lib.h"
+#include "ahi_msg_view.h"
+#include "ahi_msg_batch.h"
 
 /*AHI message definitions*/
 #define TL_HEADER_LEN      9
@@ -61,86 +64,119 @@ static enum alif_mac154_status_code alif_ahi_msg_status_convert(uint16_t status)
 	return ALIF_MAC154_STATUS_FAILED;
 }
 
-int alif_ahi_msg_valid_message(struct msg_buf *p_msg)
+static int alif_ahi_msg_check(const uint8_t *msg, uint16_t msg_len)
 {
-
-	if (p_msg->msg_len < TL_HEADER_LEN) {
+	if (msg_len < TL_HEADER_LEN) {
 		return 0;
 	}
-	if (MSG_TYPE(p_msg->msg) != AHI_KE_MSG_TYPE || MSG_DST_TASK(p_msg->msg) != TASK_ID_AHI ||
-	    MSG_SRC_TASK(p_msg->msg) != TASK_ID_MAC154APP) {
+	if (MSG_TYPE(msg) != AHI_KE_MSG_TYPE || MSG_DST_TASK(msg) != TASK_ID_AHI ||
+	    MSG_SRC_TASK(msg) != TASK_ID_MAC154APP) {
 		return -1;
 	}
-	if (MSG_LENGTH(p_msg->msg) + TL_HEADER_LEN >= MAX_MSG_LEN) {
+	if (MSG_LENGTH(msg) + TL_HEADER_LEN >= MAX_MSG_LEN) {
 		return -2;
 	}
-	if (p_msg->msg_len < MSG_LENGTH(p_msg->msg) + TL_HEADER_LEN) {
+	if (msg_len < MSG_LENGTH(msg) + TL_HEADER_LEN) {
 		return 0;
 	}
 	return 1;
 }
 
-bool alif_ahi_msg_resp_event_recv(struct msg_buf *p_dest_msg, struct msg_buf *p_src_msg)
+int alif_ahi_msg_valid_message(struct msg_buf *p_msg)
 {
+	return alif_ahi_msg_check(p_msg->msg, p_msg->msg_len);
+}
 
+static bool alif_ahi_msg_resp_match(const struct msg_buf *p_dest_msg, const uint8_t *msg)
+{
 	if (!p_dest_msg) {
 		return false;
 	}
-	if (p_dest_msg->rsp_event && p_dest_msg->rsp_event != MSG_COMMAND(p_src_msg->msg)) {
+	if (p_dest_msg->rsp_event && p_dest_msg->rsp_event != MSG_COMMAND(msg)) {
 		return false;
 	}
-	mac154app_cmd_t *p_cmd = (mac154app_cmd_t *)(p_src_msg->msg + TL_HEADER_LEN);
+	const mac154app_cmd_t *p_cmd = (const mac154app_cmd_t *)(msg + TL_HEADER_LEN);
 
 	if (p_dest_msg->rsp_msg && p_dest_msg->rsp_msg != p_cmd->cmd_code) {
 		return false;
 	}
+	return true;
+}
+
+bool alif_ahi_msg_resp_event_recv(struct msg_buf *p_dest_msg, struct msg_buf *p_src_msg)
+{
+	if (!alif_ahi_msg_resp_match(p_dest_msg, p_src_msg->msg)) {
+		return false;
+	}
 	memcpy(p_dest_msg->msg, p_src_msg->msg, p_src_msg->msg_len);
 	p_dest_msg->msg_len = p_src_msg->msg_len;
 	return true;
 }
 
-bool alif_ahi_msg_recv_ind_recv_1_1_0(struct msg_buf *p_msg, uint16_t *p_ctx, int8_t *p_rssi,
-				      bool *p_frame_pending, uint64_t *p_timestamp, uint8_t *p_len,
-				      uint8_t **p_data, bool *ack_sec, uint32_t *ack_fc,
-				      uint8_t *ack_key_idx)
+static bool alif_ahi_msg_rx_frame_parse(const uint8_t *msg, uint16_t msg_len,
+					struct alif_ahi_msg_rx_frame *p_frame)
 {
-	if (p_msg->msg_len < TL_HEADER_LEN + sizeof(mac154app_rx_frame_ind_t)) {
+	if (msg_len < TL_HEADER_LEN + sizeof(mac154app_rx_frame_ind_t)) {
 		return false;
 	}
-	if (MSG_TYPE(p_msg->msg) != AHI_KE_MSG_TYPE || MSG_COMMAND(p_msg->msg) != MAC154APP_IND) {
+	if (MSG_TYPE(msg) != AHI_KE_MSG_TYPE || MSG_COMMAND(msg) != MAC154APP_IND) {
 		return false;
 	}
-	mac154app_rx_frame_ind_t *p_ind = (mac154app_rx_frame_ind_t *)(p_msg->msg + TL_HEADER_LEN);
+	const mac154app_rx_frame_ind_t *p_ind =
+		(const mac154app_rx_frame_ind_t *)(msg + TL_HEADER_LEN);
 
 	if (p_ind->ind_code != MAC154APP_RX_FRAME) {
 		return false;
 	}
+	p_frame->ctx = p_ind->dummy;
+	p_frame->rssi = p_ind->rssi;
+	p_frame->frame_pending = p_ind->frame_pending;
+	p_frame->timestamp = ((uint64_t)p_ind->timestamp_h << 32) + p_ind->timestamp_l;
+	p_frame->len = p_ind->len;
+	p_frame->data = p_ind->data;
+	p_frame->ack_sec = p_ind->ack_seb;
+	p_frame->ack_fc = p_ind->ack_fc;
+	p_frame->ack_key_idx = p_ind->ack_keyid;
+	return true;
+}
+
+bool alif_ahi_msg_recv_ind_recv_1_1_0(struct msg_buf *p_msg, uint16_t *p_ctx, int8_t *p_rssi,
+				      bool *p_frame_pending, uint64_t *p_timestamp, uint8_t *p_len,
+				      uint8_t **p_data, bool *ack_sec, uint32_t *ack_fc,
+				      uint8_t *ack_key_idx)
+{
+	struct alif_ahi_msg_rx_frame frame;
+
+	if (!alif_ahi_msg_rx_frame_parse(p_msg->msg, p_msg->msg_len, &frame)) {
+		return false;
+	}
 	if (p_ctx) {
-		*p_ctx = p_ind->dummy;
+		*p_ctx = frame.ctx;
 	}
 	if (p_rssi) {
-		*p_rssi = p_ind->rssi;
+		*p_rssi = frame.rssi;
 	}
 	if (p_frame_pending) {
-		*p_frame_pending = p_ind->frame_pending;
+		*p_frame_pending = frame.frame_pending;
 	}
 	if (p_timestamp) {
-		*p_timestamp = ((uint64_t)p_ind->timestamp_h << 32) + p_ind->timestamp_l;
+		*p_timestamp = frame.timestamp;
 	}
 	if (p_len) {
-		*p_len = p_ind->len;
+		*p_len = frame.len;
 	}
 	if (p_data) {
-		*p_data = p_ind->data;
+		/* Points back into p_msg, which is writable */
+		*p_data = (uint8_t *)frame.data;
 	}
 	if (ack_sec) {
-		*ack_sec = p_ind->ack_seb;
+		*ack_sec = frame.ack_sec;
 	}
 	if (ack_fc) {
-		*ack_fc = p_ind->ack_fc;
+		*ack_fc = frame.ack_fc;
 	}
 	if (ack_key_idx) {
-		*ack_key_idx = p_ind->ack_keyid;
+		*ack_key_idx = frame.ack_key_idx;
 	}
 	return true;
 }
@@ -348,18 +384,27 @@ bool alif_ahi_msg_error_recv(struct msg_buf *p_msg, uint16_t *p_dummy,
 	return true;
 }
 
-static void *alif_ahi_msg_header_validate(struct msg_buf *p_msg, uint16_t cmd, int msg_size)
+static const void *alif_ahi_msg_payload(const uint8_t *msg, uint16_t msg_len, uint16_t cmd,
+					int msg_size)
 {
-	if (!p_msg || p_msg->msg_len < TL_HEADER_LEN + msg_size) {
+	if (msg_len < TL_HEADER_LEN + msg_size) {
+		return NULL;
+	}
+	if (MSG_TYPE(msg) != AHI_KE_MSG_TYPE) {
 		return NULL;
 	}
-	if (MSG_TYPE(p_msg->msg) != AHI_KE_MSG_TYPE) {
+	if (MSG_COMMAND(msg) != cmd || MSG_LENGTH(msg) < msg_size) {
 		return NULL;
 	}
-	if (MSG_COMMAND(p_msg->msg) != cmd || MSG_LENGTH(p_msg->msg) < msg_size) {
+	return &msg[TL_HEADER_LEN];
+}
+
+static void *alif_ahi_msg_header_validate(struct msg_buf *p_msg, uint16_t cmd, int msg_size)
+{
+	if (!p_msg) {
 		return NULL;
 	}
-	return &p_msg->msg[TL_HEADER_LEN];
+	return (void *)alif_ahi_msg_payload(p_msg->msg, p_msg->msg_len, cmd, msg_size);
 }
 
 static void *alif_ahi_msg_header_write(struct msg_buf *p_msg, uint16_t cmd_length,
@@ -1069,12 +1114,13 @@ void alif_ahi_msg_dbg_rf(struct msg_buf *p_msg, uint16_t ctx, uint8_t write, uin
  *
  */
 
-enum alif_mac154_status_code alif_ahi_msg_status(struct msg_buf *p_msg, uint8_t *p_ctx)
+static enum alif_mac154_status_code alif_ahi_msg_status_parse(const uint8_t *msg,
+							      uint16_t msg_len, uint8_t *p_ctx)
 {
-	mac154app_cmp_evt_t *p_cmd_resp;
+	const mac154app_cmp_evt_t *p_cmd_resp;
 
 	p_cmd_resp =
-		alif_ahi_msg_header_validate(p_msg, MAC154APP_CMP_EVT, sizeof(mac154app_cmp_evt_t));
+		alif_ahi_msg_payload(msg, msg_len, MAC154APP_CMP_EVT, sizeof(mac154app_cmp_evt_t));
 
 	if (!p_cmd_resp) {
 		return ALIF_MAC154_STATUS_COMM_FAILURE;
@@ -1086,6 +1132,14 @@ enum alif_mac154_status_code alif_ahi_msg_status(struct msg_buf *p_msg, uint8_t
 	return alif_ahi_msg_status_convert(p_cmd_resp->status);
 }
 
+enum alif_mac154_status_code alif_ahi_msg_status(struct msg_buf *p_msg, uint8_t *p_ctx)
+{
+	if (!p_msg) {
+		return ALIF_MAC154_STATUS_COMM_FAILURE;
+	}
+	return alif_ahi_msg_status_parse(p_msg->msg, p_msg->msg_len, p_ctx);
+}
+
 enum alif_mac154_status_code alif_ahi_msg_dbm(struct msg_buf *p_msg, uint8_t *p_ctx, int8_t *p_dbm)
 {
 	mac154app_dbm_get_cmp_evt_t *p_cmd_resp;
@@ -1557,18 +1611,22 @@ enum alif_mac154_status_code alif_ahi_msg_rf_dbg_resp(struct msg_buf *p_msg, uin
 	return ALIF_MAC154_STATUS_OK;
 }
 
-enum alif_mac154_status_code alif_ahi_msg_tx_start_resp_1_1_0(struct msg_buf *p_msg, uint8_t *p_ctx,
-							      int8_t *p_rssi, uint64_t *p_timestamp,
-							      uint8_t *p_ack, uint8_t *p_ack_len)
+static enum alif_mac154_status_code
+alif_ahi_msg_tx_start_resp_parse(const uint8_t *msg, uint16_t msg_len, uint8_t *p_ctx,
+				 int8_t *p_rssi, uint64_t *p_timestamp, const uint8_t **p_ack,
+				 uint8_t *p_ack_len)
 {
-	mac154app_tx_single_cmp_evt_t *p_cmd_resp;
+	const mac154app_tx_single_cmp_evt_t *p_cmd_resp;
 
-	p_cmd_resp = alif_ahi_msg_header_validate(p_msg, MAC154APP_CMP_EVT,
-						  sizeof(mac154app_tx_single_cmp_evt_t));
+	p_cmd_resp = alif_ahi_msg_payload(msg, msg_len, MAC154APP_CMP_EVT,
+					  sizeof(mac154app_tx_single_cmp_evt_t));
 
 	if (!p_cmd_resp) {
 		return ALIF_MAC154_STATUS_COMM_FAILURE;
 	}
+	if (msg_len < TL_HEADER_LEN + sizeof(mac154app_tx_single_cmp_evt_t) + p_cmd_resp->length) {
+		return ALIF_MAC154_STATUS_COMM_FAILURE;
+	}
 	if (p_ctx) {
 		*p_ctx = p_cmd_resp->dummy;
 	}
@@ -1589,7 +1647,33 @@ enum alif_mac154_status_code alif_ahi_msg_tx_start_resp_1_1_0(struct msg_buf *p_
 		*p_ack_len = p_cmd_resp->length;
 	}
 	if (p_ack) {
-		memcpy(p_ack, p_cmd_resp->ack_msg_begin, p_cmd_resp->length);
+		*p_ack = p_cmd_resp->ack_msg_begin;
+	}
+
+	return ALIF_MAC154_STATUS_OK;
+}
+
+enum alif_mac154_status_code alif_ahi_msg_tx_start_resp_1_1_0(struct msg_buf *p_msg, uint8_t *p_ctx,
+							      int8_t *p_rssi, uint64_t *p_timestamp,
+							      uint8_t *p_ack, uint8_t *p_ack_len)
+{
+	enum alif_mac154_status_code status;
+	const uint8_t *p_ack_frame;
+	uint8_t ack_len;
+
+	if (!p_msg) {
+		return ALIF_MAC154_STATUS_COMM_FAILURE;
+	}
+	status = alif_ahi_msg_tx_start_resp_parse(p_msg->msg, p_msg->msg_len, p_ctx, p_rssi,
+						  p_timestamp, &p_ack_frame, &ack_len);
+	if (status != ALIF_MAC154_STATUS_OK) {
+		return status;
+	}
+	if (p_ack_len) {
+		*p_ack_len = ack_len;
+	}
+	if (p_ack) {
+		memcpy(p_ack, p_ack_frame, ack_len);
 	}
 
 	return ALIF_MAC154_STATUS_OK;
@@ -2044,3 +2128,216 @@ enum alif_mac154_status_code alif_ahi_msg_set_frame_counter_resp(struct msg_buf
 	}
 	return alif_ahi_msg_status_convert(p_cmd_resp->status);
 }
+
+/*
+ * Zero-copy receive path
+ *
+ */
+
+void alif_ahi_msg_rx_buf_init(struct ahi_msg_rx_buf *p_buf, const uint8_t *data, uint16_t len,
+			      ahi_msg_rx_buf_release_t release, void *user_data)
+{
+	p_buf->data = data;
+	p_buf->len = len;
+	p_buf->release = release;
+	p_buf->user_data = user_data;
+	atomic_set(&p_buf->ref, 1);
+}
+
+void alif_ahi_msg_rx_buf_unref(struct ahi_msg_rx_buf *p_buf)
+{
+	if (atomic_dec(&p_buf->ref) == 1 && p_buf->release) {
+		p_buf->release(p_buf);
+	}
+}
+
+int alif_ahi_msg_view_get(struct ahi_msg_rx_buf *p_buf, uint16_t offset,
+			  struct ahi_msg_view *p_view)
+{
+	int ret;
+
+	if (offset >= p_buf->len) {
+		return 0;
+	}
+	ret = alif_ahi_msg_check(p_buf->data + offset, p_buf->len - offset);
+	if (ret != 1) {
+		return ret;
+	}
+	atomic_inc(&p_buf->ref);
+	p_view->msg = p_buf->data + offset;
+	p_view->msg_len = MSG_LENGTH(p_view->msg) + TL_HEADER_LEN;
+	p_view->p_buf = p_buf;
+	return 1;
+}
+
+void alif_ahi_msg_view_ref(const struct ahi_msg_view *p_view, struct ahi_msg_view *p_copy)
+{
+	atomic_inc(&p_view->p_buf->ref);
+	*p_copy = *p_view;
+}
+
+void alif_ahi_msg_view_release(struct ahi_msg_view *p_view)
+{
+	if (!p_view->p_buf) {
+		return;
+	}
+	alif_ahi_msg_rx_buf_unref(p_view->p_buf);
+	p_view->msg = NULL;
+	p_view->msg_len = 0;
+	p_view->p_buf = NULL;
+}
+
+bool alif_ahi_msg_view_resp_event_recv(const struct msg_buf *p_dest_msg,
+				       const struct ahi_msg_view *p_view,
+				       struct ahi_msg_view *p_resp)
+{
+	if (!alif_ahi_msg_resp_match(p_dest_msg, p_view->msg)) {
+		return false;
+	}
+	alif_ahi_msg_view_ref(p_view, p_resp);
+	return true;
+}
+
+bool alif_ahi_msg_view_recv_ind(const struct ahi_msg_view *p_view,
+				struct alif_ahi_msg_rx_frame *p_frame)
+{
+	return alif_ahi_msg_rx_frame_parse(p_view->msg, p_view->msg_len, p_frame);
+}
+
+enum alif_mac154_status_code alif_ahi_msg_view_status(const struct ahi_msg_view *p_view,
+						      uint8_t *p_ctx)
+{
+	return alif_ahi_msg_status_parse(p_view->msg, p_view->msg_len, p_ctx);
+}
+
+enum alif_mac154_status_code alif_ahi_msg_view_tx_start_resp(const struct ahi_msg_view *p_view,
+							     uint8_t *p_ctx, int8_t *p_rssi,
+							     uint64_t *p_timestamp,
+							     const uint8_t **p_ack,
+							     uint8_t *p_ack_len)
+{
+	return alif_ahi_msg_tx_start_resp_parse(p_view->msg, p_view->msg_len, p_ctx, p_rssi,
+						p_timestamp, p_ack, p_ack_len);
+}
+
+/*
+ * Batched command submission
+ *
+ */
+
+void alif_ahi_msg_batch_init(struct ahi_msg_batch *p_batch)
+{
+	p_batch->len = 0;
+	p_batch->count = 0;
+	p_batch->pending = 0;
+}
+
+int alif_ahi_msg_batch_add(struct ahi_msg_batch *p_batch, const struct msg_buf *p_msg)
+{
+	struct ahi_msg_batch_entry *p_entry;
+	const mac154app_cmd_t *p_cmd;
+
+	if (p_msg->msg_len < TL_HEADER_LEN + sizeof(mac154app_cmd_t) ||
+	    MSG_TYPE(p_msg->msg) != AHI_KE_MSG_TYPE || MSG_COMMAND(p_msg->msg) != MAC154APP_CMD) {
+		return -EINVAL;
+	}
+	if (p_batch->count >= CONFIG_IEEE802154_ALIF_AHI_MSG_BATCH_MAX_CMDS ||
+	    p_batch->len + p_msg->msg_len > sizeof(p_batch->buf)) {
+		return -ENOMEM;
+	}
+
+	p_cmd = (const mac154app_cmd_t *)(p_msg->msg + TL_HEADER_LEN);
+
+	for (int i = 0; i < p_batch->count; i++) {
+		p_entry = &p_batch->entry[i];
+		if (!p_entry->done && p_entry->rsp_event == p_msg->rsp_event &&
+		    p_entry->rsp_msg == p_msg->rsp_msg && p_entry->ctx == p_cmd->dummy) {
+			return -EALREADY;
+		}
+	}
+
+	memcpy(&p_batch->buf[p_batch->len], p_msg->msg, p_msg->msg_len);
+	p_batch->len += p_msg->msg_len;
+
+	p_entry = &p_batch->entry[p_batch->count];
+	memset(p_entry, 0, sizeof(*p_entry));
+	p_entry->rsp_event = p_msg->rsp_event;
+	p_entry->rsp_msg = p_msg->rsp_msg;
+	p_entry->ctx = p_cmd->dummy;
+	p_entry->status = ALIF_MAC154_STATUS_COMM_FAILURE;
+	p_batch->pending++;
+
+	return p_batch->count++;
+}
+
+const uint8_t *alif_ahi_msg_batch_data(const struct ahi_msg_batch *p_batch, uint16_t *p_len)
+{
+	*p_len = p_batch->len;
+	return p_batch->buf;
+}
+
+static int alif_ahi_msg_batch_match(struct ahi_msg_batch *p_batch, const uint8_t *msg,
+				    uint16_t msg_len)
+{
+	struct ahi_msg_batch_entry *p_entry;
+	const mac154app_cmd_t *p_cmd;
+
+	if (msg_len < TL_HEADER_LEN + sizeof(mac154app_cmd_t) || MSG_TYPE(msg) != AHI_KE_MSG_TYPE) {
+		return -ENOENT;
+	}
+
+	/* Completions start with the command code and context, as commands do */
+	p_cmd = (const mac154app_cmd_t *)(msg + TL_HEADER_LEN);
+
+	for (int i = 0; i < p_batch->count; i++) {
+		p_entry = &p_batch->entry[i];
+		if (p_entry->done || p_entry->ctx != p_cmd->dummy) {
+			continue;
+		}
+		if (p_entry->rsp_event && p_entry->rsp_event != MSG_COMMAND(msg)) {
+			continue;
+		}
+		if (p_entry->rsp_msg && p_entry->rsp_msg != p_cmd->cmd_code) {
+			continue;
+		}
+		if (MSG_COMMAND(msg) == MAC154APP_CMP_EVT) {
+			p_entry->status = alif_ahi_msg_status_parse(msg, msg_len, NULL);
+		} else {
+			p_entry->status = ALIF_MAC154_STATUS_OK;
+		}
+		p_entry->done = true;
+		p_batch->pending--;
+		return i;
+	}
+	return -ENOENT;
+}
+
+int alif_ahi_msg_batch_resp_event_recv(struct ahi_msg_batch *p_batch,
+				       const struct msg_buf *p_src_msg)
+{
+	return alif_ahi_msg_batch_match(p_batch, p_src_msg->msg, p_src_msg->msg_len);
+}
+
+int alif_ahi_msg_batch_view_resp_recv(struct ahi_msg_batch *p_batch,
+				      const struct ahi_msg_view *p_view)
+{
+	int idx = alif_ahi_msg_batch_match(p_batch, p_view->msg, p_view->msg_len);
+
+	if (idx >= 0) {
+		alif_ahi_msg_view_ref(p_view, &p_batch->entry[idx].resp);
+	}
+	return idx;
+}
+
+bool alif_ahi_msg_batch_done(const struct ahi_msg_batch *p_batch)
+{
+	return p_batch->pending == 0;
+}
+
+void alif_ahi_msg_batch_release(struct ahi_msg_batch *p_batch)
+{
+	for (int i = 0; i < p_batch->count; i++) {
+		alif_ahi_msg_view_release(&p_batch->entry[i].resp);
+	}
+	alif_ahi_msg_batch_init(p_batch);
+}
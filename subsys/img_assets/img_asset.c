@@ -0,0 +1,287 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file img_asset.c
+ */
+
+#include "img_asset.h"
+
+#include <errno.h>
+#include <string.h>
+
+#define QOI_HEADER_SIZE  14
+#define QOI_PADDING_SIZE 8
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xc0
+#define QOI_OP_RGB   0xfe
+#define QOI_OP_RGBA  0xff
+#define QOI_MASK_2   0xc0
+
+#define PX_A(px) ((px) >> 24)
+#define PX_R(px) (((px) >> 16) & 0xff)
+#define PX_G(px) (((px) >> 8) & 0xff)
+#define PX_B(px) ((px) & 0xff)
+
+#define PX_PACK(r, g, b, a)                                                                        \
+	(((uint32_t)(a) << 24) | ((uint32_t)(r) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(b))
+
+typedef void (*store_fn)(uint8_t *dst, uint32_t px);
+
+static inline void put16(uint8_t *dst, uint32_t v)
+{
+	dst[0] = v & 0xff;
+	dst[1] = v >> 8;
+}
+
+/* Same rule as the pre-converted SAMPLE_PHOTO_ALPHA8 */
+static void store_alpha8(uint8_t *dst, uint32_t px)
+{
+	dst[0] = (PX_R(px) + PX_G(px) + PX_B(px)) / 3;
+}
+
+static void store_argb8888(uint8_t *dst, uint32_t px)
+{
+	dst[0] = PX_B(px);
+	dst[1] = PX_G(px);
+	dst[2] = PX_R(px);
+	dst[3] = PX_A(px);
+}
+
+static void store_argb4444(uint8_t *dst, uint32_t px)
+{
+	put16(dst, (PX_A(px) >> 4) << 12 | (PX_R(px) >> 4) << 8 | (PX_G(px) >> 4) << 4 |
+			   PX_B(px) >> 4);
+}
+
+static void store_argb1555(uint8_t *dst, uint32_t px)
+{
+	put16(dst, (PX_A(px) >> 7) << 15 | (PX_R(px) >> 3) << 10 | (PX_G(px) >> 3) << 5 |
+			   PX_B(px) >> 3);
+}
+
+static void store_rgba8888(uint8_t *dst, uint32_t px)
+{
+	dst[0] = PX_A(px);
+	dst[1] = PX_B(px);
+	dst[2] = PX_G(px);
+	dst[3] = PX_R(px);
+}
+
+static void store_rgba4444(uint8_t *dst, uint32_t px)
+{
+	put16(dst, (PX_R(px) >> 4) << 12 | (PX_G(px) >> 4) << 8 | (PX_B(px) >> 4) << 4 |
+			   PX_A(px) >> 4);
+}
+
+static void store_rgba5551(uint8_t *dst, uint32_t px)
+{
+	put16(dst, (PX_R(px) >> 3) << 11 | (PX_G(px) >> 3) << 6 | (PX_B(px) >> 3) << 1 |
+			   PX_A(px) >> 7);
+}
+
+static void store_bgr888(uint8_t *dst, uint32_t px)
+{
+	dst[0] = PX_R(px);
+	dst[1] = PX_G(px);
+	dst[2] = PX_B(px);
+}
+
+static void store_rgb888(uint8_t *dst, uint32_t px)
+{
+	dst[0] = PX_B(px);
+	dst[1] = PX_G(px);
+	dst[2] = PX_R(px);
+}
+
+static void store_rgb565(uint8_t *dst, uint32_t px)
+{
+	put16(dst, (PX_R(px) >> 3) << 11 | (PX_G(px) >> 2) << 5 | PX_B(px) >> 3);
+}
+
+static const struct {
+	uint8_t bpp;
+	store_fn store;
+} formats[] = {
+	[COLOR_ALPHA8] = {1, store_alpha8},     [COLOR_ARGB8888] = {4, store_argb8888},
+	[COLOR_ARGB4444] = {2, store_argb4444}, [COLOR_ARGB1555] = {2, store_argb1555},
+	[COLOR_RGBA8888] = {4, store_rgba8888}, [COLOR_RGBA4444] = {2, store_rgba4444},
+	[COLOR_RGBA5551] = {2, store_rgba5551}, [COLOR_BGR888] = {3, store_bgr888},
+	[COLOR_RGB888] = {3, store_rgb888},     [COLOR_RGB565] = {2, store_rgb565},
+};
+
+static inline uint32_t qoi_hash(uint32_t px)
+{
+	return (PX_R(px) * 3 + PX_G(px) * 5 + PX_B(px) * 7 + PX_A(px) * 11) % 64;
+}
+
+static inline uint32_t read_be32(const uint8_t *p)
+{
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static uint32_t next_pixel(struct img_asset_decoder *dec)
+{
+	if (dec->run) {
+		dec->run--;
+		return dec->px;
+	}
+
+	if (dec->pos >= dec->end) {
+		dec->overrun = true;
+		return dec->px;
+	}
+
+	/* Every op is at most 5 bytes, the end marker keeps the reads in bounds */
+	const uint8_t *p = dec->pos;
+	const uint8_t b1 = *p++;
+	uint32_t px = dec->px;
+
+	if (b1 == QOI_OP_RGB) {
+		px = PX_PACK(p[0], p[1], p[2], PX_A(px));
+		p += 3;
+	} else if (b1 == QOI_OP_RGBA) {
+		px = PX_PACK(p[0], p[1], p[2], p[3]);
+		p += 4;
+	} else {
+		uint8_t r = PX_R(px);
+		uint8_t g = PX_G(px);
+		uint8_t b = PX_B(px);
+
+		switch (b1 & QOI_MASK_2) {
+		case QOI_OP_INDEX:
+			px = dec->index[b1];
+			break;
+		case QOI_OP_DIFF:
+			r += ((b1 >> 4) & 0x03) - 2;
+			g += ((b1 >> 2) & 0x03) - 2;
+			b += (b1 & 0x03) - 2;
+			px = PX_PACK(r, g, b, PX_A(px));
+			break;
+		case QOI_OP_LUMA: {
+			const uint8_t b2 = *p++;
+			const int vg = (b1 & 0x3f) - 32;
+
+			r += vg - 8 + ((b2 >> 4) & 0x0f);
+			g += vg;
+			b += vg - 8 + (b2 & 0x0f);
+			px = PX_PACK(r, g, b, PX_A(px));
+			break;
+		}
+		default:
+			dec->run = b1 & 0x3f;
+			break;
+		}
+	}
+
+	dec->index[qoi_hash(px)] = px;
+	dec->px = px;
+	dec->pos = p;
+
+	return px;
+}
+
+const struct img_asset *img_asset_find(const char *name)
+{
+	for (size_t i = 0; i < img_asset_count; i++) {
+		if (strcmp(img_asset_index[i]->name, name) == 0) {
+			return img_asset_index[i];
+		}
+	}
+
+	return NULL;
+}
+
+uint32_t img_asset_bytes_per_pixel(uint32_t format)
+{
+	if (format >= sizeof(formats) / sizeof(formats[0])) {
+		return 0;
+	}
+
+	return formats[format].bpp;
+}
+
+int img_asset_decoder_init(struct img_asset_decoder *dec, const struct img_asset *asset)
+{
+	const uint8_t *data = asset->data;
+
+	if (asset->data_size < QOI_HEADER_SIZE + QOI_PADDING_SIZE ||
+	    memcmp(data, "qoif", 4) != 0 || read_be32(&data[4]) != asset->width ||
+	    read_be32(&data[8]) != asset->height || (data[12] != 3 && data[12] != 4)) {
+		return -EINVAL;
+	}
+
+	memset(dec, 0, sizeof(*dec));
+	dec->asset = asset;
+	dec->pos = data + QOI_HEADER_SIZE;
+	dec->end = data + asset->data_size - QOI_PADDING_SIZE;
+	dec->px = PX_PACK(0, 0, 0, 0xff);
+
+	return 0;
+}
+
+int img_asset_decode_rows(struct img_asset_decoder *dec, uint32_t format, void *dst,
+			  uint32_t pitch, uint32_t rows)
+{
+	const uint32_t width = dec->asset->width;
+	const uint32_t bpp = img_asset_bytes_per_pixel(format);
+	uint8_t *line = dst;
+
+	if (bpp == 0) {
+		return -ENOTSUP;
+	}
+
+	if (pitch < width) {
+		return -EINVAL;
+	}
+
+	if (rows > dec->asset->height - dec->row) {
+		rows = dec->asset->height - dec->row;
+	}
+
+	const store_fn store = formats[format].store;
+
+	for (uint32_t y = 0; y < rows; y++) {
+		uint8_t *out = line;
+
+		for (uint32_t x = 0; x < width; x++) {
+			store(out, next_pixel(dec));
+			out += bpp;
+		}
+
+		line += pitch * bpp;
+	}
+
+	dec->row += rows;
+
+	if (dec->overrun ||
+	    (dec->row == dec->asset->height && (dec->pos != dec->end || dec->run != 0))) {
+		return -EIO;
+	}
+
+	return rows;
+}
+
+int img_asset_decode(const struct img_asset *asset, uint32_t format, void *dst, uint32_t pitch)
+{
+	struct img_asset_decoder dec;
+	int ret = img_asset_decoder_init(&dec, asset);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = img_asset_decode_rows(&dec, format, dst, pitch, asset->height);
+
+	return ret < 0 ? ret : 0;
+}
@@ -0,0 +1,114 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/**
+ * @file img_asset.h
+ *
+ * Compressed image asset store. Every asset is kept once in flash as a QOI
+ * stream and expanded on demand into the color format the caller asks for,
+ * either as a whole image or a few rows at a time. Assets are packed with
+ * scripts/img_asset_pack.py, which also generates img_asset_data.c/.h.
+ */
+
+#ifndef IMG_ASSET_H
+#define IMG_ASSET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "assets.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct img_asset {
+	const char *name;
+	/* QOI stream including header and end marker. */
+	const uint8_t *data;
+	uint32_t data_size;
+	uint32_t width;
+	uint32_t height;
+};
+
+/* Streaming decoder state, see img_asset_decode_rows(). */
+struct img_asset_decoder {
+	const struct img_asset *asset;
+	const uint8_t *pos;
+	const uint8_t *end;
+	/* Previous pixel and QOI color cache, packed as 0xAARRGGBB. */
+	uint32_t px;
+	uint32_t index[64];
+	uint32_t run;
+	uint32_t row;
+	bool overrun;
+};
+
+/* All packed assets, generated by scripts/img_asset_pack.py. */
+extern const struct img_asset *const img_asset_index[];
+extern const size_t img_asset_count;
+
+/**
+ * @brief Look up an asset by the name it was packed with.
+ *
+ * @return Asset, or NULL if there is none of that name.
+ */
+const struct img_asset *img_asset_find(const char *name);
+
+/**
+ * @brief Bytes per pixel of a decoder output format.
+ *
+ * Only the packed formats from ALPHA8 up to RGB565 are supported; convert
+ * an ARGB8888 decode with AIPL to get a YUV format.
+ *
+ * @return Bytes per pixel, or 0 if @p format is not supported.
+ */
+uint32_t img_asset_bytes_per_pixel(uint32_t format);
+
+/**
+ * @brief Start decoding an asset from the first row.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the asset is not a valid QOI stream.
+ */
+int img_asset_decoder_init(struct img_asset_decoder *dec, const struct img_asset *asset);
+
+/**
+ * @brief Decode the next rows of an asset.
+ *
+ * @param dec Decoder set up with img_asset_decoder_init().
+ * @param format Output format, one of enum color_format_t.
+ * @param dst Output buffer for @p rows rows.
+ * @param pitch Output line length in pixels, at least the asset width.
+ * @param rows Number of rows wanted.
+ *
+ * @return Number of rows written, 0 once the whole image was decoded.
+ * @retval -ENOTSUP if @p format is not supported.
+ * @retval -EINVAL if @p pitch is smaller than the asset width.
+ * @retval -EIO if the stream is corrupted.
+ */
+int img_asset_decode_rows(struct img_asset_decoder *dec, uint32_t format, void *dst,
+			  uint32_t pitch, uint32_t rows);
+
+/**
+ * @brief Decode a whole asset.
+ *
+ * @p dst must hold pitch * height * img_asset_bytes_per_pixel(format) bytes.
+ *
+ * @retval 0 on success, otherwise as img_asset_decode_rows().
+ */
+int img_asset_decode(const struct img_asset *asset, uint32_t format, void *dst, uint32_t pitch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_ASSET_H */
@@ -0,0 +1,20 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/* Generated by scripts/img_asset_pack.py, do not edit. */
+
+#ifndef IMG_ASSET_DATA_H
+#define IMG_ASSET_DATA_H
+
+#include "img_asset.h"
+
+extern const struct img_asset IMG_ASSET_SAMPLE_PHOTO;
+
+#endif /* IMG_ASSET_DATA_H */
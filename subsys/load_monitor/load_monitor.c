@@ -0,0 +1,403 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/tracing/tracing.h>
+#if defined(CONFIG_CPU_CORTEX_M)
+#include <cmsis_core.h>
+#endif
+#include "load_monitor.h"
+
+LOG_MODULE_REGISTER(load_monitor, CONFIG_LOAD_MONITOR_LOG_LEVEL);
+
+#define MAX_THREADS CONFIG_LOAD_MONITOR_MAX_THREADS
+#define MAX_ISRS    CONFIG_LOAD_MONITOR_MAX_ISRS
+/* Deepest ISR nesting followed; deeper levels are charged to the outer ISR */
+#define MAX_NESTING 8
+
+#define NO_SLOT -1
+
+static struct {
+	struct load_monitor_snapshot totals;
+	/* Cycle counter at the last accounted event */
+	uint64_t last;
+	/* Thread slot running when not in an ISR, NO_SLOT for "other" */
+	int current;
+	/* ISR slots of the active interrupts, innermost last */
+	int8_t isr_stack[MAX_NESTING];
+	int nesting;
+	struct k_spinlock lock;
+} lm = {
+	.current = NO_SLOT,
+};
+
+/*
+ * A 32-bit count wraps after about 10 s at 400 MHz. Without a 64-bit timer it
+ * is extended here, which holds while events come more often than that.
+ */
+static uint64_t cycles_now(void)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cycle_get_64();
+#else
+	uint32_t now = k_cycle_get_32();
+
+	return lm.last + (uint32_t)(now - (uint32_t)lm.last);
+#endif
+}
+
+/* Charge the cycles since the last event to whatever ran; lock held */
+static void charge(void)
+{
+	uint64_t now = cycles_now();
+	uint64_t delta = now - lm.last;
+	struct load_monitor_snapshot *t = &lm.totals;
+
+	lm.last = now;
+	t->total_cycles += delta;
+
+	if (lm.nesting > 0) {
+		int slot = lm.isr_stack[MIN(lm.nesting, MAX_NESTING) - 1];
+
+		t->isr_cycles += delta;
+		if (slot != NO_SLOT) {
+			t->isrs[slot].cycles += delta;
+		}
+	} else if (lm.current != NO_SLOT) {
+		t->threads[lm.current].cycles += delta;
+	} else {
+		t->other_cycles += delta;
+	}
+}
+
+static void copy_name(struct load_monitor_thread *th)
+{
+	const char *name = k_thread_name_get((k_tid_t)th->thread);
+
+	if (name != NULL && name[0] != '\0') {
+		strncpy(th->name, name, sizeof(th->name) - 1);
+		th->name[sizeof(th->name) - 1] = '\0';
+	} else {
+		snprintk(th->name, sizeof(th->name), "%p", th->thread);
+	}
+}
+
+/* Pointer lookup on every switch; names are only read when a slot is taken */
+static int thread_slot(const struct k_thread *thread)
+{
+	struct load_monitor_snapshot *t = &lm.totals;
+	int free_slot = NO_SLOT;
+
+	for (int i = 0; i < t->num_threads; i++) {
+		if (t->threads[i].thread == thread) {
+			return i;
+		}
+		if (t->threads[i].thread == NULL && free_slot == NO_SLOT) {
+			free_slot = i;
+		}
+	}
+
+	if (free_slot == NO_SLOT) {
+		if (t->num_threads == MAX_THREADS) {
+			return NO_SLOT;
+		}
+		free_slot = t->num_threads++;
+	}
+
+	struct load_monitor_thread *th = &t->threads[free_slot];
+
+	th->thread = thread;
+	th->cycles = 0;
+	copy_name(th);
+#if defined(CONFIG_THREAD_NAME)
+	th->idle = strcmp(k_thread_name_get((k_tid_t)thread), "idle") == 0;
+#else
+	th->idle = k_thread_priority_get((k_tid_t)thread) == K_IDLE_PRIO;
+#endif
+
+	return free_slot;
+}
+
+static int current_irq(void)
+{
+#if defined(CONFIG_CPU_CORTEX_M)
+	return (int)__get_IPSR() - 16;
+#else
+	return 0;
+#endif
+}
+
+static int isr_slot(int irq)
+{
+	struct load_monitor_snapshot *t = &lm.totals;
+
+	for (int i = 0; i < t->num_isrs; i++) {
+		if (t->isrs[i].irq == irq) {
+			return i;
+		}
+	}
+
+	if (t->num_isrs == MAX_ISRS) {
+		return NO_SLOT;
+	}
+
+	t->isrs[t->num_isrs].irq = irq;
+	t->isrs[t->num_isrs].count = 0;
+	t->isrs[t->num_isrs].cycles = 0;
+
+	return t->num_isrs++;
+}
+
+void sys_trace_thread_switched_out_user(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+
+	charge();
+	k_spin_unlock(&lm.lock, key);
+}
+
+void sys_trace_thread_switched_in_user(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+
+	charge();
+	lm.current = thread_slot(k_current_get());
+	k_spin_unlock(&lm.lock, key);
+}
+
+void sys_trace_thread_abort_user(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+	struct load_monitor_snapshot *t = &lm.totals;
+
+	charge();
+	for (int i = 0; i < t->num_threads; i++) {
+		if (t->threads[i].thread == thread) {
+			/* Keep the total consistent and free the slot */
+			t->other_cycles += t->threads[i].cycles;
+			t->threads[i].thread = NULL;
+			t->threads[i].cycles = 0;
+			if (lm.current == i) {
+				lm.current = NO_SLOT;
+			}
+			break;
+		}
+	}
+	k_spin_unlock(&lm.lock, key);
+}
+
+void sys_trace_thread_name_set_user(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+	struct load_monitor_snapshot *t = &lm.totals;
+
+	for (int i = 0; i < t->num_threads; i++) {
+		if (t->threads[i].thread == thread) {
+			copy_name(&t->threads[i]);
+			break;
+		}
+	}
+	k_spin_unlock(&lm.lock, key);
+}
+
+void sys_trace_isr_enter_user(int nested_interrupts)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+
+	ARG_UNUSED(nested_interrupts);
+
+	charge();
+	if (lm.nesting < MAX_NESTING) {
+		int slot = isr_slot(current_irq());
+
+		lm.isr_stack[lm.nesting] = slot;
+		if (slot != NO_SLOT) {
+			lm.totals.isrs[slot].count++;
+		}
+	}
+	lm.nesting++;
+	k_spin_unlock(&lm.lock, key);
+}
+
+void sys_trace_isr_exit_user(int nested_interrupts)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+
+	ARG_UNUSED(nested_interrupts);
+
+	charge();
+	if (lm.nesting > 0) {
+		lm.nesting--;
+	}
+	k_spin_unlock(&lm.lock, key);
+}
+
+void load_monitor_snapshot(struct load_monitor_snapshot *snap)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+
+	charge();
+	*snap = lm.totals;
+	k_spin_unlock(&lm.lock, key);
+}
+
+void load_monitor_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+	uint32_t epoch = lm.totals.epoch + 1;
+
+	memset(&lm.totals, 0, sizeof(lm.totals));
+	lm.totals.epoch = epoch;
+	lm.last = cycles_now();
+	/* The ISR stack stays; an active interrupt simply has no slot now */
+	for (int i = 0; i < MIN(lm.nesting, MAX_NESTING); i++) {
+		lm.isr_stack[i] = NO_SLOT;
+	}
+	lm.current = k_is_in_isr() ? NO_SLOT : thread_slot(k_current_get());
+	k_spin_unlock(&lm.lock, key);
+}
+
+uint64_t load_monitor_idle_cycles(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lm.lock);
+	uint64_t idle = 0;
+
+	charge();
+	for (int i = 0; i < lm.totals.num_threads; i++) {
+		if (lm.totals.threads[i].idle) {
+			idle += lm.totals.threads[i].cycles;
+		}
+	}
+	k_spin_unlock(&lm.lock, key);
+
+	return idle;
+}
+
+static bool comparable(const struct load_monitor_snapshot *prev,
+		       const struct load_monitor_snapshot *cur)
+{
+	return prev->epoch == cur->epoch && cur->total_cycles > prev->total_cycles;
+}
+
+uint64_t load_monitor_thread_delta(const struct load_monitor_snapshot *prev,
+				   const struct load_monitor_snapshot *cur, int i)
+{
+	const struct load_monitor_thread *th = &cur->threads[i];
+
+	if (prev->epoch == cur->epoch && i < prev->num_threads &&
+	    prev->threads[i].thread == th->thread && prev->threads[i].cycles <= th->cycles) {
+		return th->cycles - prev->threads[i].cycles;
+	}
+
+	return th->cycles;
+}
+
+uint64_t load_monitor_isr_delta(const struct load_monitor_snapshot *prev,
+				const struct load_monitor_snapshot *cur, int i)
+{
+	if (prev->epoch == cur->epoch && i < prev->num_isrs) {
+		return cur->isrs[i].cycles - prev->isrs[i].cycles;
+	}
+
+	return cur->isrs[i].cycles;
+}
+
+uint32_t load_monitor_load(const struct load_monitor_snapshot *prev,
+			   const struct load_monitor_snapshot *cur)
+{
+	if (!comparable(prev, cur)) {
+		return 0;
+	}
+
+	uint64_t elapsed = cur->total_cycles - prev->total_cycles;
+	uint64_t idle = 0;
+
+	for (int i = 0; i < cur->num_threads; i++) {
+		if (cur->threads[i].idle) {
+			idle += load_monitor_thread_delta(prev, cur, i);
+		}
+	}
+
+	return (uint32_t)((elapsed - MIN(idle, elapsed)) * 1000 / elapsed);
+}
+
+#if CONFIG_LOAD_MONITOR_LOG_INTERVAL_MS > 0
+
+#define LOG_TOP_THREADS 3
+
+static struct load_monitor_snapshot log_prev;
+static struct load_monitor_snapshot log_cur;
+
+static void log_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	uint64_t elapsed;
+	char line[128];
+	int len;
+
+	load_monitor_snapshot(&log_cur);
+
+	if (comparable(&log_prev, &log_cur)) {
+		uint32_t load = load_monitor_load(&log_prev, &log_cur);
+		uint64_t isr = log_cur.isr_cycles - log_prev.isr_cycles;
+		bool shown[CONFIG_LOAD_MONITOR_MAX_THREADS] = {0};
+
+		elapsed = log_cur.total_cycles - log_prev.total_cycles;
+		len = snprintk(line, sizeof(line), "load %u.%u%%, isr %u.%u%%", load / 10, load % 10,
+			       (uint32_t)(isr * 1000 / elapsed) / 10,
+			       (uint32_t)(isr * 1000 / elapsed) % 10);
+
+		/* Busiest non-idle threads first */
+		for (int n = 0; n < LOG_TOP_THREADS && len < (int)sizeof(line); n++) {
+			uint64_t best_cycles = 0;
+			int best = NO_SLOT;
+
+			for (int i = 0; i < log_cur.num_threads; i++) {
+				uint64_t c = load_monitor_thread_delta(&log_prev, &log_cur, i);
+
+				if (!shown[i] && !log_cur.threads[i].idle &&
+				    log_cur.threads[i].thread != NULL && c > best_cycles) {
+					best_cycles = c;
+					best = i;
+				}
+			}
+			if (best == NO_SLOT) {
+				break;
+			}
+
+			uint32_t pm = (uint32_t)(best_cycles * 1000 / elapsed);
+
+			shown[best] = true;
+			len += snprintk(line + len, sizeof(line) - len, ", %s %u.%u%%",
+					log_cur.threads[best].name, pm / 10, pm % 10);
+		}
+
+		LOG_INF("%s", line);
+	}
+
+	log_prev = log_cur;
+	k_work_reschedule(dwork, K_MSEC(CONFIG_LOAD_MONITOR_LOG_INTERVAL_MS));
+}
+
+static K_WORK_DELAYABLE_DEFINE(log_work, log_work_fn);
+
+static int load_monitor_log_init(void)
+{
+	k_work_reschedule(&log_work, K_MSEC(CONFIG_LOAD_MONITOR_LOG_INTERVAL_MS));
+	return 0;
+}
+
+SYS_INIT(load_monitor_log_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* CONFIG_LOAD_MONITOR_LOG_INTERVAL_MS > 0 */
@@ -0,0 +1,90 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   load_monitor.h
+ *
+ * CPU load monitor. The thread switch and ISR tracing hooks charge the
+ * cycles since the previous event to the thread or interrupt that ran. The
+ * accumulated totals are read as snapshots; the load over a period is the
+ * difference of two snapshots.
+ */
+#ifndef __LOAD_MONITOR_H
+#define __LOAD_MONITOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOAD_MONITOR_NAME_LEN 16
+
+struct load_monitor_thread {
+	const struct k_thread *thread;
+	char name[LOAD_MONITOR_NAME_LEN];
+	uint64_t cycles;
+	bool idle;
+};
+
+struct load_monitor_isr {
+	/* IRQ line, or a negative exception number on Cortex-M */
+	int irq;
+	uint32_t count;
+	uint64_t cycles;
+};
+
+struct load_monitor_snapshot {
+	/* Cycles accounted since the last reset, the sum of everything below */
+	uint64_t total_cycles;
+	uint64_t isr_cycles;
+	/* Threads without a slot and threads that have exited */
+	uint64_t other_cycles;
+	/* Incremented by load_monitor_reset(), snapshots of different epochs do not compare */
+	uint32_t epoch;
+	uint8_t num_threads;
+	uint8_t num_isrs;
+	struct load_monitor_thread threads[CONFIG_LOAD_MONITOR_MAX_THREADS];
+	struct load_monitor_isr isrs[CONFIG_LOAD_MONITOR_MAX_ISRS];
+};
+
+/* Copy the current totals, including the time of the running thread. */
+void load_monitor_snapshot(struct load_monitor_snapshot *snap);
+
+/* Clear all totals and forget the tracked threads and interrupts. */
+void load_monitor_reset(void);
+
+/**
+ * @brief Busy time between two snapshots.
+ *
+ * @return Non-idle share of the elapsed cycles in per mille, 0 if @p prev is
+ *         not older than @p cur.
+ */
+uint32_t load_monitor_load(const struct load_monitor_snapshot *prev,
+			   const struct load_monitor_snapshot *cur);
+
+/* Cycles of thread slot @p i of @p cur since @p prev; all of them for a thread new in @p cur */
+uint64_t load_monitor_thread_delta(const struct load_monitor_snapshot *prev,
+				   const struct load_monitor_snapshot *cur, int i);
+
+/* Cycles of ISR slot @p i of @p cur since @p prev */
+uint64_t load_monitor_isr_delta(const struct load_monitor_snapshot *prev,
+				const struct load_monitor_snapshot *cur, int i);
+
+/* Cycles spent in the idle thread so far */
+uint64_t load_monitor_idle_cycles(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOAD_MONITOR_H */
@@ -0,0 +1,96 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <string.h>
+#include <zephyr/shell/shell.h>
+#include "load_monitor.h"
+
+static struct load_monitor_snapshot top_prev;
+static struct load_monitor_snapshot top_cur;
+
+static void print_share(const struct shell *sh, const char *name, uint64_t cycles,
+			uint64_t total, uint64_t elapsed)
+{
+	uint32_t pm = elapsed ? (uint32_t)(cycles * 1000 / elapsed) : 0;
+
+	shell_print(sh, "%-16s %5u.%u%% %12llu", name, pm / 10, pm % 10,
+		    (unsigned long long)k_cyc_to_ms_floor64(total));
+}
+
+/* Usage since the previous "load top" (or reset), and the total run time */
+static int cmd_top(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	load_monitor_snapshot(&top_cur);
+
+	if (top_prev.epoch != top_cur.epoch || top_prev.total_cycles >= top_cur.total_cycles) {
+		/* First call after a reset: usage since the reset */
+		memset(&top_prev, 0, sizeof(top_prev));
+		top_prev.epoch = top_cur.epoch;
+	}
+
+	uint64_t elapsed = top_cur.total_cycles - top_prev.total_cycles;
+	uint32_t load = load_monitor_load(&top_prev, &top_cur);
+
+	shell_print(sh, "CPU load %u.%u%% over %llu ms", load / 10, load % 10,
+		    (unsigned long long)k_cyc_to_ms_floor64(elapsed));
+	shell_print(sh, "%-16s %7s %12s", "THREAD", "CPU", "TOTAL[ms]");
+
+	for (int i = 0; i < top_cur.num_threads; i++) {
+		const struct load_monitor_thread *th = &top_cur.threads[i];
+
+		if (th->thread == NULL) {
+			continue;
+		}
+		print_share(sh, th->name, load_monitor_thread_delta(&top_prev, &top_cur, i),
+			    th->cycles, elapsed);
+	}
+	print_share(sh, "<other>", top_cur.other_cycles - top_prev.other_cycles,
+		    top_cur.other_cycles, elapsed);
+
+	shell_print(sh, "%-16s %7s %12s %10s", "ISR", "CPU", "TOTAL[ms]", "COUNT");
+	print_share(sh, "<all>", top_cur.isr_cycles - top_prev.isr_cycles, top_cur.isr_cycles,
+		    elapsed);
+
+	for (int i = 0; i < top_cur.num_isrs; i++) {
+		const struct load_monitor_isr *isr = &top_cur.isrs[i];
+		uint64_t cycles = load_monitor_isr_delta(&top_prev, &top_cur, i);
+		uint32_t pm = elapsed ? (uint32_t)(cycles * 1000 / elapsed) : 0;
+
+		shell_print(sh, "%-3s %-12d %5u.%u%% %12llu %10u", isr->irq < 0 ? "exc" : "irq",
+			    isr->irq < 0 ? isr->irq + 16 : isr->irq, pm / 10, pm % 10,
+			    (unsigned long long)k_cyc_to_ms_floor64(isr->cycles), isr->count);
+	}
+
+	top_prev = top_cur;
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	load_monitor_reset();
+	shell_print(sh, "Load statistics cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(load_cmds,
+	SHELL_CMD(top, NULL, "Per thread and per interrupt CPU usage since the last call",
+		  cmd_top),
+	SHELL_CMD(reset, NULL, "Clear the load statistics", cmd_reset),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(load, &load_cmds, "CPU load monitor", NULL);
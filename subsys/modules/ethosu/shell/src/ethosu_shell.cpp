@@ -29,12 +29,25 @@ static struct k_thread ethosu_thread;
 static k_sem ethosu_sem;
 static atomic_t ethosu_running = 0;
 
+/* May be overridden with a tight size generated by scripts/gen_arena_sizes.py */
+#ifndef ALIF_ETHOSU_SHELL_TENSOR_ARENA_SIZE
+#define ALIF_ETHOSU_SHELL_TENSOR_ARENA_SIZE TENSOR_ARENA_SIZE
+#endif
+
 __attribute__((section(".bss.tflm_arena"),
-	       aligned(16))) static uint8_t tensor_arena[TENSOR_ARENA_SIZE];
+	       aligned(16))) static uint8_t tensor_arena[ALIF_ETHOSU_SHELL_TENSOR_ARENA_SIZE];
+static size_t arena_peak;
+
+static void report_arena_hwm(void)
+{
+	printk("arena_hwm: model=%s pool=tensor_arena macro=ALIF_ETHOSU_SHELL_TENSOR_ARENA_SIZE "
+	       "used=%zu size=%zu\n",
+	       modelName, arena_peak, sizeof(tensor_arena));
+}
 
 static void ethosu_worker(void *, void *, void *)
 {
-	InferenceProcess::InferenceProcess npu(tensor_arena, TENSOR_ARENA_SIZE);
+	InferenceProcess::InferenceProcess npu(tensor_arena, sizeof(tensor_arena));
 	uint32_t jobcnt = 0;
 	bool status;
 
@@ -56,6 +69,11 @@ static void ethosu_worker(void *, void *, void *)
 		status = npu.runJob(job);
 		jobcnt++;
 
+		if (npu.getArenaPeakBytes() > arena_peak) {
+			arena_peak = npu.getArenaPeakBytes();
+			report_arena_hwm();
+		}
+
 		if ((jobcnt % 100) == 0) {
 			printk("%s jobcnt=%u status=%s\n", modelName, jobcnt,
 			       status ? "failed" : "ok");
@@ -94,8 +112,27 @@ static int cmd_stop(const struct shell *shell, size_t, char **)
 	return 0;
 }
 
+static int cmd_arena(const struct shell *shell, size_t, char **)
+{
+	if (arena_peak == 0) {
+		shell_fprintf(shell, SHELL_VT100_COLOR_DEFAULT,
+			      "Tensor arena %zu bytes, not measured yet (run start first)\n",
+			      sizeof(tensor_arena));
+		return 0;
+	}
+
+	shell_fprintf(shell, SHELL_VT100_COLOR_DEFAULT,
+		      "Tensor arena %zu bytes, high-water mark %zu bytes (%zu%%)\n",
+		      sizeof(tensor_arena), arena_peak, 100 * arena_peak / sizeof(tensor_arena));
+	report_arena_hwm();
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmds, SHELL_CMD_ARG(start, NULL, "start", cmd_start, 1, 10),
 			       SHELL_CMD_ARG(stop, NULL, "stop", cmd_stop, 1, 10),
+			       SHELL_CMD_ARG(arena, NULL, "Tensor arena high-water mark",
+					     cmd_arena, 1, 0),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(ethosu, &sub_cmds, "Ethos-U55 commands", NULL);
@@ -0,0 +1,375 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include "video_pool.h"
+
+#if defined(CONFIG_VIDEO_POOL_BACKEND_D0LIB)
+#include <dave_d0lib.h>
+#else
+#include <stdlib.h>
+#endif
+
+LOG_MODULE_REGISTER(video_pool, CONFIG_VIDEO_POOL_LOG_LEVEL);
+
+#define MIN_SHIFT   CONFIG_VIDEO_POOL_MIN_SHIFT
+/* Blocks above 16 MiB are not pooled */
+#define MAX_SHIFT   24
+#define SL_BITS     3
+#define SL_COUNT    BIT(SL_BITS)
+#define NUM_CLASSES ((MAX_SHIFT - MIN_SHIFT) * SL_COUNT)
+#define NO_CLASS    0xffff
+
+#define CACHE_LIMIT ((size_t)CONFIG_VIDEO_POOL_CACHE_LIMIT * 1024)
+
+/* Buffers are aligned to a cache line, the header sits right in front */
+#define ALIGNMENT 32
+#define HDR_SIZE  32
+#define OVERHEAD  (HDR_SIZE + ALIGNMENT - 1)
+
+/* Largest and number of free blocks looked for by video_pool_probe_heap() */
+#define PROBE_MAX_SHIFT  30
+#define PROBE_MAX_BLOCKS 32
+
+#define MAGIC_LIVE 0x56504c42
+#define MAGIC_FREE 0x56504c46
+
+struct block_hdr {
+	uint32_t magic;
+	uint16_t cls;
+	/* Requested size */
+	size_t size;
+	struct block_hdr *next;
+	/* Pointer returned by the backend */
+	void *raw;
+};
+
+BUILD_ASSERT(sizeof(struct block_hdr) <= HDR_SIZE);
+
+struct size_class {
+	struct block_hdr *free;
+	uint32_t live;
+	uint32_t cached;
+	uint32_t peak_live;
+};
+
+static struct {
+	struct size_class classes[NUM_CLASSES];
+	struct video_pool_stats stats;
+	struct k_spinlock lock;
+} pool;
+
+static inline void *backend_alloc(size_t size)
+{
+#if defined(CONFIG_VIDEO_POOL_BACKEND_D0LIB)
+	return d0_allocvidmem(size);
+#else
+	return malloc(size);
+#endif
+}
+
+static inline void backend_free(void *ptr)
+{
+#if defined(CONFIG_VIDEO_POOL_BACKEND_D0LIB)
+	d0_freevidmem(ptr);
+#else
+	free(ptr);
+#endif
+}
+
+/* Class of a request, or NO_CLASS if it is too small or too large to pool */
+static inline uint32_t size_class(size_t size)
+{
+	if (size <= BIT(MIN_SHIFT) || size > BIT(MAX_SHIFT)) {
+		return NO_CLASS;
+	}
+
+	const uint32_t v = size - 1;
+	const uint32_t fl = 31 - __builtin_clz(v);
+	const uint32_t sl = (v >> (fl - SL_BITS)) & (SL_COUNT - 1);
+
+	return (fl - MIN_SHIFT) * SL_COUNT + sl;
+}
+
+static inline size_t class_size(uint32_t cls)
+{
+	const uint32_t fl = cls / SL_COUNT + MIN_SHIFT;
+	const uint32_t sl = cls % SL_COUNT;
+
+	return (size_t)(SL_COUNT + sl + 1) << (fl - SL_BITS);
+}
+
+static inline size_t block_bytes(const struct block_hdr *hdr)
+{
+	return OVERHEAD + (hdr->cls == NO_CLASS ? hdr->size : class_size(hdr->cls));
+}
+
+void *video_pool_alloc(size_t size)
+{
+	const uint32_t cls = size_class(size);
+	const size_t bytes = OVERHEAD + (cls == NO_CLASS ? size : class_size(cls));
+	struct video_pool_stats *st = &pool.stats;
+	struct block_hdr *hdr = NULL;
+	k_spinlock_key_t key;
+
+	if (size == 0) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&pool.lock);
+	st->allocs++;
+	if (cls != NO_CLASS && pool.classes[cls].free != NULL) {
+		hdr = pool.classes[cls].free;
+		pool.classes[cls].free = hdr->next;
+		pool.classes[cls].cached--;
+		st->cached_bytes -= bytes;
+		st->hits++;
+	}
+	k_spin_unlock(&pool.lock, key);
+
+	if (hdr == NULL) {
+		void *raw = backend_alloc(bytes);
+
+		if (raw == NULL && video_pool_trim() > 0) {
+			raw = backend_alloc(bytes);
+		}
+		if (raw == NULL) {
+			key = k_spin_lock(&pool.lock);
+			st->failures++;
+			k_spin_unlock(&pool.lock, key);
+			LOG_WRN("Out of video memory for %zu bytes", size);
+			return NULL;
+		}
+
+		hdr = (struct block_hdr *)(ROUND_UP((uintptr_t)raw + HDR_SIZE, ALIGNMENT) -
+					   HDR_SIZE);
+		hdr->raw = raw;
+	}
+
+	hdr->magic = MAGIC_LIVE;
+	hdr->cls = cls;
+	hdr->size = size;
+
+	key = k_spin_lock(&pool.lock);
+	st->live_bytes += size;
+	st->live_block_bytes += bytes;
+	st->peak_live_bytes = MAX(st->peak_live_bytes, st->live_bytes);
+	st->peak_held_bytes = MAX(st->peak_held_bytes, st->live_block_bytes + st->cached_bytes);
+	if (cls != NO_CLASS) {
+		struct size_class *c = &pool.classes[cls];
+
+		c->live++;
+		c->peak_live = MAX(c->peak_live, c->live);
+	}
+	k_spin_unlock(&pool.lock, key);
+
+	return (uint8_t *)hdr + HDR_SIZE;
+}
+
+void video_pool_free(void *ptr)
+{
+	struct video_pool_stats *st = &pool.stats;
+	struct block_hdr *hdr;
+	k_spinlock_key_t key;
+	bool keep = false;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	hdr = (struct block_hdr *)((uint8_t *)ptr - HDR_SIZE);
+
+	key = k_spin_lock(&pool.lock);
+
+	if (hdr->magic != MAGIC_LIVE) {
+		k_spin_unlock(&pool.lock, key);
+		LOG_ERR("Invalid or double free of %p", ptr);
+		return;
+	}
+
+	const size_t bytes = block_bytes(hdr);
+
+	st->live_bytes -= hdr->size;
+	st->live_block_bytes -= bytes;
+
+	if (hdr->cls != NO_CLASS) {
+		struct size_class *c = &pool.classes[hdr->cls];
+
+		c->live--;
+		keep = CACHE_LIMIT == 0 || st->cached_bytes + bytes <= CACHE_LIMIT;
+		if (keep) {
+			hdr->magic = MAGIC_FREE;
+			hdr->next = c->free;
+			c->free = hdr;
+			c->cached++;
+			st->cached_bytes += bytes;
+		}
+	}
+
+	if (!keep) {
+		hdr->magic = 0;
+	}
+
+	k_spin_unlock(&pool.lock, key);
+
+	if (!keep) {
+		backend_free(hdr->raw);
+	}
+}
+
+uint32_t video_pool_trim(void)
+{
+	struct block_hdr *list = NULL;
+	uint32_t count = 0;
+	k_spinlock_key_t key = k_spin_lock(&pool.lock);
+
+	for (size_t i = 0; i < NUM_CLASSES; i++) {
+		struct size_class *c = &pool.classes[i];
+
+		while (c->free != NULL) {
+			struct block_hdr *hdr = c->free;
+
+			c->free = hdr->next;
+			hdr->magic = 0;
+			hdr->next = list;
+			list = hdr;
+			count++;
+		}
+		c->cached = 0;
+	}
+	pool.stats.cached_bytes = 0;
+	pool.stats.trimmed += count;
+
+	k_spin_unlock(&pool.lock, key);
+
+	while (list != NULL) {
+		struct block_hdr *next = list->next;
+
+		backend_free(list->raw);
+		list = next;
+	}
+
+	return count;
+}
+
+void video_pool_get_stats(struct video_pool_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool.lock);
+
+	*stats = pool.stats;
+	k_spin_unlock(&pool.lock, key);
+}
+
+/* Allocate the largest free block of at least 2^MIN_SHIFT bytes, NULL if there is none */
+static void *probe_largest(size_t *size)
+{
+	size_t lo = BIT(MIN_SHIFT);
+	size_t hi;
+	void *ptr;
+
+	/* Double until the backend fails, then bisect down to the alignment */
+	for (hi = lo; hi <= BIT(PROBE_MAX_SHIFT); hi *= 2) {
+		ptr = backend_alloc(hi);
+		if (ptr == NULL) {
+			break;
+		}
+		backend_free(ptr);
+		lo = hi;
+	}
+
+	if (hi == BIT(MIN_SHIFT)) {
+		return NULL;
+	}
+
+	while (hi - lo > ALIGNMENT) {
+		const size_t mid = ROUND_DOWN(lo + (hi - lo) / 2, ALIGNMENT);
+
+		ptr = backend_alloc(mid);
+		if (ptr != NULL) {
+			backend_free(ptr);
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	*size = lo;
+	return backend_alloc(lo);
+}
+
+void video_pool_probe_heap(struct video_pool_heap_stats *stats)
+{
+	void *held = NULL;
+	size_t size;
+	void *ptr;
+
+	*stats = (struct video_pool_heap_stats){0};
+
+	/* Take the largest block until none is left, chained through their first word */
+	while (stats->free_blocks < PROBE_MAX_BLOCKS && (ptr = probe_largest(&size)) != NULL) {
+		if (stats->free_blocks == 0) {
+			stats->largest_free = size;
+		}
+		stats->free_bytes += size;
+		stats->free_blocks++;
+		*(void **)ptr = held;
+		held = ptr;
+	}
+
+	while (held != NULL) {
+		ptr = *(void **)held;
+		backend_free(held);
+		held = ptr;
+	}
+}
+
+size_t video_pool_num_classes(void)
+{
+	return NUM_CLASSES;
+}
+
+int video_pool_get_class_stats(size_t idx, struct video_pool_class_stats *stats)
+{
+	if (idx >= NUM_CLASSES) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pool.lock);
+	const struct size_class *c = &pool.classes[idx];
+
+	stats->block_size = class_size(idx);
+	stats->live = c->live;
+	stats->cached = c->cached;
+	stats->peak_live = c->peak_live;
+	k_spin_unlock(&pool.lock, key);
+
+	return 0;
+}
+
+void video_pool_reset_stats(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool.lock);
+	struct video_pool_stats *st = &pool.stats;
+
+	st->allocs = 0;
+	st->hits = 0;
+	st->failures = 0;
+	st->trimmed = 0;
+	st->peak_live_bytes = st->live_bytes;
+	st->peak_held_bytes = st->live_block_bytes + st->cached_bytes;
+	for (size_t i = 0; i < NUM_CLASSES; i++) {
+		pool.classes[i].peak_live = pool.classes[i].live;
+	}
+	k_spin_unlock(&pool.lock, key);
+}
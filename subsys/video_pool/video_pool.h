@@ -0,0 +1,107 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+/*
+ *   video_pool.h
+ *
+ * Size-class cache for frame-sized video buffers. Requests are rounded up
+ * to one of eight classes per power of two, at most 12.5% larger than
+ * asked for. Released blocks stay on a per-class free list and serve the
+ * next request of that class, so images that are created and destroyed
+ * over and over do not fragment the backend heap.
+ */
+#ifndef __VIDEO_POOL_H
+#define __VIDEO_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct video_pool_stats {
+	/* Bytes requested by callers and not released yet. */
+	size_t live_bytes;
+	/* Backend memory behind the live buffers, with rounding and headers. */
+	size_t live_block_bytes;
+	/* Released blocks kept for reuse. */
+	size_t cached_bytes;
+	size_t peak_live_bytes;
+	/* Highest backend footprint, live plus cached blocks. */
+	size_t peak_held_bytes;
+	uint32_t allocs;
+	/* Requests served from a free list without calling the backend. */
+	uint32_t hits;
+	/* Requests that failed even after the cache was trimmed. */
+	uint32_t failures;
+	/* Cached blocks given back to the backend. */
+	uint32_t trimmed;
+};
+
+/* Free backend memory, see video_pool_probe_heap(). */
+struct video_pool_heap_stats {
+	/* Free memory in blocks of at least 2^CONFIG_VIDEO_POOL_MIN_SHIFT bytes. */
+	size_t free_bytes;
+	uint32_t free_blocks;
+	/* Largest single allocation the backend can still satisfy. */
+	size_t largest_free;
+};
+
+struct video_pool_class_stats {
+	size_t block_size;
+	uint32_t live;
+	uint32_t cached;
+	uint32_t peak_live;
+};
+
+/**
+ * @brief Allocate a video buffer.
+ *
+ * @return Buffer of at least @p size bytes, or NULL.
+ */
+void *video_pool_alloc(size_t size);
+
+/* Release a buffer from video_pool_alloc(); NULL is ignored. */
+void video_pool_free(void *ptr);
+
+/**
+ * @brief Return all cached blocks to the backend.
+ *
+ * @return Number of blocks released.
+ */
+uint32_t video_pool_trim(void);
+
+void video_pool_get_stats(struct video_pool_stats *stats);
+
+/**
+ * @brief Measure how fragmented the free backend memory is.
+ *
+ * Disruptive, for manual diagnostics only. Neither backend can report its
+ * free blocks, so the largest block is found by allocating from the
+ * backend, repeatedly until it runs out, and everything is released again.
+ * Allocations by other threads, e.g. camera frames, fail while it runs.
+ * Never called by the pool itself; "vidpool probe" runs it on request.
+ */
+void video_pool_probe_heap(struct video_pool_heap_stats *stats);
+
+/* Number of size classes, for video_pool_get_class_stats(). */
+size_t video_pool_num_classes(void);
+
+int video_pool_get_class_stats(size_t idx, struct video_pool_class_stats *stats);
+
+/* Clear the counters and restart the peaks from the current usage. */
+void video_pool_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __VIDEO_POOL_H */
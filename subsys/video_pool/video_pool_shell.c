@@ -0,0 +1,105 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ *
+ */
+
+#include <zephyr/shell/shell.h>
+#include "video_pool.h"
+
+static uint32_t per_mille(size_t part, size_t whole)
+{
+	return whole ? (uint32_t)((uint64_t)part * 1000 / whole) : 0;
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct video_pool_stats st;
+	struct video_pool_class_stats cs;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	video_pool_get_stats(&st);
+
+	/* Rounding and headers of the live blocks, memory asked for but not used */
+	const size_t waste = st.live_block_bytes - st.live_bytes;
+	const uint32_t waste_pm = per_mille(waste, st.live_block_bytes);
+	const uint32_t hit_pm = per_mille(st.hits, st.allocs);
+
+	shell_print(sh, "Live      %10zu bytes in %zu bytes of blocks, %u.%u%% rounding", st.live_bytes,
+		    st.live_block_bytes, waste_pm / 10, waste_pm % 10);
+	shell_print(sh, "Cached    %10zu bytes", st.cached_bytes);
+	shell_print(sh, "Peak      %10zu bytes live, %zu bytes held", st.peak_live_bytes,
+		    st.peak_held_bytes);
+	shell_print(sh, "Allocs    %10u, %u.%u%% from the cache, %u failed, %u blocks trimmed",
+		    st.allocs, hit_pm / 10, hit_pm % 10, st.failures, st.trimmed);
+
+	shell_print(sh, "%12s %8s %8s %8s", "BLOCK", "LIVE", "CACHED", "PEAK");
+	for (size_t i = 0; i < video_pool_num_classes(); i++) {
+		video_pool_get_class_stats(i, &cs);
+		if (cs.peak_live == 0 && cs.cached == 0) {
+			continue;
+		}
+		shell_print(sh, "%12zu %8u %8u %8u", cs.block_size, cs.live, cs.cached,
+			    cs.peak_live);
+	}
+
+	return 0;
+}
+
+static int cmd_probe(const struct shell *sh, size_t argc, char **argv)
+{
+	struct video_pool_heap_stats hs;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	video_pool_probe_heap(&hs);
+
+	/* Share of the free memory that cannot be had in one piece */
+	const uint32_t frag_pm =
+		hs.free_bytes ? 1000 - per_mille(hs.largest_free, hs.free_bytes) : 0;
+
+	shell_print(sh, "Heap      %10zu bytes free in %u blocks, largest %zu, %u.%u%% fragmented",
+		    hs.free_bytes, hs.free_blocks, hs.largest_free, frag_pm / 10, frag_pm % 10);
+
+	return 0;
+}
+
+static int cmd_trim(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Released %u cached blocks", video_pool_trim());
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	video_pool_reset_stats();
+	shell_print(sh, "Pool statistics cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(vidpool_cmds,
+	SHELL_CMD(stats, NULL, "Usage, peaks and per size class blocks", cmd_stats),
+	SHELL_CMD(probe, NULL,
+		  "Measure heap fragmentation; briefly takes all free video memory, "
+		  "so other allocations (e.g. camera frames) may fail meanwhile",
+		  cmd_probe),
+	SHELL_CMD(trim, NULL, "Return cached blocks to the heap", cmd_trim),
+	SHELL_CMD(reset, NULL, "Clear the counters and peaks", cmd_reset),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(vidpool, &vidpool_cmds, "Video memory pool", NULL);
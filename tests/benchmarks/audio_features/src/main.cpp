@@ -0,0 +1,157 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+/*
+ * Times the shared audio front end on a synthetic MicroNet KWS input: 49 MFCC
+ * frames of 640 samples (40 ms at 16 kHz) with 10 features each, then the
+ * normalisation helpers over the whole feature map.
+ */
+
+#include "FeatureNormalise.hpp"
+#include "MicroNetKwsMfcc.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <zephyr/kernel.h>
+
+using namespace arm::app::audio;
+
+namespace
+{
+constexpr size_t kNumFeatures = 10;
+constexpr size_t kNumFrames = 49;
+constexpr size_t kFrameLength = 640;
+constexpr size_t kFrameStride = 320;
+constexpr size_t kAudioLength = (kNumFrames - 1) * kFrameStride + kFrameLength;
+constexpr size_t kRepeats = 5;
+
+constexpr float kQuantScale = 1.5f;
+constexpr int kQuantOffset = 20;
+
+int16_t audio[kAudioLength];
+float features[kNumFrames * kNumFeatures];
+int8_t quantFeatures[kNumFrames * kNumFeatures];
+
+struct Timing {
+	uint32_t minCycles = UINT32_MAX;
+	uint32_t maxCycles = 0;
+	uint64_t sumCycles = 0;
+	uint32_t count = 0;
+
+	void Add(uint32_t cycles)
+	{
+		minCycles = MIN(minCycles, cycles);
+		maxCycles = MAX(maxCycles, cycles);
+		sumCycles += cycles;
+		count++;
+	}
+};
+
+void FillAudio()
+{
+	/* Two tones plus a little deterministic noise, roughly -12 dBFS. */
+	uint32_t lcg = 1;
+
+	for (size_t i = 0; i < kAudioLength; i++) {
+		const float t = static_cast<float>(i) / 16000.f;
+		float s = 4000.f * sinf(2.f * 3.14159265f * 440.f * t) +
+			  2000.f * sinf(2.f * 3.14159265f * 1800.f * t);
+
+		lcg = lcg * 1664525u + 1013904223u;
+		s += static_cast<float>(static_cast<int32_t>(lcg >> 16) - 32768) / 64.f;
+		audio[i] = static_cast<int16_t>(s);
+	}
+}
+
+void Report(const char *name, const Timing &timing)
+{
+	const uint32_t avg = static_cast<uint32_t>(timing.sumCycles / MAX(timing.count, 1u));
+
+	printk("%-18s runs=%u min=%u avg=%u max=%u cycles, avg=%u us\n", name, timing.count,
+	       timing.minCycles, avg, timing.maxCycles, k_cyc_to_us_floor32(avg));
+}
+
+template <typename Mfcc>
+void BenchMfcc(const char *name, Mfcc &mfcc)
+{
+	Timing floatTiming;
+	Timing quantTiming;
+
+	for (size_t r = 0; r < kRepeats; r++) {
+		for (size_t f = 0; f < kNumFrames; f++) {
+			const int16_t *frame = &audio[f * kFrameStride];
+
+			uint32_t start = k_cycle_get_32();
+			mfcc.MfccCompute(frame, &features[f * kNumFeatures]);
+			floatTiming.Add(k_cycle_get_32() - start);
+
+			start = k_cycle_get_32();
+			mfcc.template MfccComputeQuant<int8_t>(frame, kQuantScale, kQuantOffset,
+							       &quantFeatures[f * kNumFeatures]);
+			quantTiming.Add(k_cycle_get_32() - start);
+		}
+	}
+
+	printk("%s:\n", name);
+	Report("  float", floatTiming);
+	Report("  int8", quantTiming);
+}
+
+void BenchNormalise()
+{
+	Timing dequant;
+	Timing standardise;
+	Timing quant;
+
+	for (size_t r = 0; r < kRepeats; r++) {
+		uint32_t start = k_cycle_get_32();
+		DequantiseFeatures(quantFeatures, features, ARRAY_SIZE(features), kQuantScale,
+				   kQuantOffset);
+		dequant.Add(k_cycle_get_32() - start);
+
+		start = k_cycle_get_32();
+		StandardiseFeatures(features, ARRAY_SIZE(features));
+		standardise.Add(k_cycle_get_32() - start);
+
+		start = k_cycle_get_32();
+		QuantiseFeatures(features, quantFeatures, ARRAY_SIZE(features), kQuantScale,
+				 kQuantOffset);
+		quant.Add(k_cycle_get_32() - start);
+	}
+
+	printk("normalise (%zu features):\n", ARRAY_SIZE(features));
+	Report("  dequantise", dequant);
+	Report("  standardise", standardise);
+	Report("  quantise", quant);
+}
+} /* namespace */
+
+int main()
+{
+	printk("audio_features benchmark begin: %zu frames x %zu samples, %zu features\n",
+	       kNumFrames, kFrameLength, kNumFeatures);
+
+	FillAudio();
+
+	MicroNetKwsMFCC mfcc(kNumFeatures, kFrameLength);
+	mfcc.Init();
+	BenchMfcc("MFCC (float)", mfcc);
+
+#if defined(AUDIO_FEATURES_Q15)
+	MicroNetKwsMFCCQ15 mfccQ15(kNumFeatures, kFrameLength);
+	mfccQ15.Init();
+	BenchMfcc("MFCC (Q15)", mfccQ15);
+#endif
+
+	BenchNormalise();
+
+	printk("audio_features benchmark end\n");
+
+	return 0;
+}
@@ -0,0 +1,222 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "cached_data_loader.h"
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+#include <cstring>
+
+using alif::executorch_utils::CachedDataLoader;
+using executorch::runtime::DataLoader;
+using executorch::runtime::Error;
+using executorch::runtime::FreeableBuffer;
+using executorch::runtime::Result;
+
+#define MODEL_SIZE   8192
+#define CACHE_SIZE   4096
+/* Three segments fit in the cache, a fourth one does not. */
+#define SEGMENT_SIZE 1024
+
+#define MODEL_PARTITION storage_partition
+
+static uint8_t model[MODEL_SIZE] __aligned(16);
+static uint8_t cache[CACHE_SIZE] __aligned(16);
+
+static const DataLoader::SegmentInfo segment_info(DataLoader::SegmentInfo::Type::Backend);
+
+static Result<FreeableBuffer> load_segment(const CachedDataLoader &loader, int index)
+{
+	return loader.load(index * SEGMENT_SIZE, SEGMENT_SIZE, segment_info);
+}
+
+static void check_segment(Result<FreeableBuffer> &buf, int index)
+{
+	zassert_true(buf.ok(), "segment %d not loaded: 0x%x", index, (int)buf.error());
+	zassert_equal(buf->size(), SEGMENT_SIZE);
+	zassert_equal((uintptr_t)buf->data() % 16, 0, "segment %d not aligned", index);
+	zassert_mem_equal(buf->data(), &model[index * SEGMENT_SIZE], SEGMENT_SIZE);
+}
+
+static void load_and_free(const CachedDataLoader &loader, int index)
+{
+	Result<FreeableBuffer> buf = load_segment(loader, index);
+
+	check_segment(buf, index);
+	buf->Free();
+}
+
+static void *setup(void)
+{
+	for (size_t i = 0; i < sizeof(model); i++) {
+		model[i] = (uint8_t)(i * 7 + i / 251);
+	}
+
+	return NULL;
+}
+
+ZTEST(cached_data_loader, test_hit_after_free)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+
+	zassert_equal(loader.size().get(), sizeof(model));
+
+	Result<FreeableBuffer> first = load_segment(loader, 1);
+
+	check_segment(first, 1);
+	zassert_not_equal(first->data(), &model[SEGMENT_SIZE], "segment not copied");
+	first->Free();
+
+	Result<FreeableBuffer> second = load_segment(loader, 1);
+
+	check_segment(second, 1);
+	second->Free();
+
+	CachedDataLoader::Stats stats = loader.stats();
+
+	zassert_equal(stats.hits, 1);
+	zassert_equal(stats.misses, 1);
+	zassert_equal(stats.bytes_loaded, SEGMENT_SIZE);
+	zassert_equal(loader.hit_rate(), 50);
+}
+
+ZTEST(cached_data_loader, test_evicts_least_recently_used)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+
+	for (int i = 0; i < 3; i++) {
+		load_and_free(loader, i);
+	}
+
+	/* Use segment 0 again so segment 1 becomes the oldest */
+	load_and_free(loader, 0);
+	load_and_free(loader, 3);
+	zassert_true(loader.stats().evictions >= 1);
+
+	uint32_t misses = loader.stats().misses;
+
+	load_and_free(loader, 0);
+	zassert_equal(loader.stats().misses, misses, "recently used segment evicted");
+
+	load_and_free(loader, 1);
+	zassert_equal(loader.stats().misses, misses + 1, "oldest segment not evicted");
+}
+
+ZTEST(cached_data_loader, test_referenced_segments_stay_pinned)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+	Result<FreeableBuffer> held[3] = {
+		load_segment(loader, 0),
+		load_segment(loader, 1),
+		load_segment(loader, 2),
+	};
+
+	for (int i = 0; i < 3; i++) {
+		check_segment(held[i], i);
+	}
+
+	Result<FreeableBuffer> full = load_segment(loader, 3);
+
+	zassert_false(full.ok());
+	zassert_equal(full.error(), Error::MemoryAllocationFailed);
+	zassert_equal(loader.stats().evictions, 0);
+
+	/* Held segments are untouched by the failed load */
+	for (int i = 0; i < 3; i++) {
+		check_segment(held[i], i);
+	}
+
+	held[1]->Free();
+	held[2]->Free();
+	load_and_free(loader, 3);
+	check_segment(held[0], 0);
+	held[0]->Free();
+}
+
+ZTEST(cached_data_loader, test_large_segment_used_in_place)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+	Result<FreeableBuffer> buf = loader.load(256, CACHE_SIZE + 256, segment_info);
+
+	zassert_true(buf.ok());
+	zassert_equal(buf->data(), &model[256]);
+	buf->Free();
+
+	CachedDataLoader::Stats stats = loader.stats();
+
+	zassert_equal(stats.bypasses, 1);
+	zassert_equal(stats.bytes_loaded, 0);
+	zassert_equal(stats.cache_used, 0);
+}
+
+ZTEST(cached_data_loader, test_heap_overhead_used_in_place)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+
+	/* As large as the cache buffer, which cannot hold it next to the heap headers */
+	Result<FreeableBuffer> buf = loader.load(0, CACHE_SIZE, segment_info);
+
+	zassert_true(buf.ok(), "load failed: 0x%x", (int)buf.error());
+	zassert_equal(buf->data(), &model[0]);
+	buf->Free();
+
+	CachedDataLoader::Stats stats = loader.stats();
+
+	zassert_equal(stats.bypasses, 1);
+	zassert_equal(stats.misses, 0);
+	zassert_equal(stats.evictions, 0);
+
+	/* Segments that fit are still cached */
+	load_and_free(loader, 1);
+	zassert_equal(loader.stats().misses, 1);
+}
+
+ZTEST(cached_data_loader, test_out_of_range)
+{
+	CachedDataLoader loader(model, sizeof(model), cache, sizeof(cache));
+	Result<FreeableBuffer> buf = loader.load(MODEL_SIZE - 16, 32, segment_info);
+
+	zassert_false(buf.ok());
+	zassert_equal(buf.error(), Error::InvalidArgument);
+}
+
+ZTEST(cached_data_loader, test_flash_source)
+{
+	const struct device *flash = FIXED_PARTITION_DEVICE(MODEL_PARTITION);
+	off_t offset = FIXED_PARTITION_OFFSET(MODEL_PARTITION);
+
+	zassert_true(device_is_ready(flash));
+	zassert_true(FIXED_PARTITION_SIZE(MODEL_PARTITION) >= MODEL_SIZE);
+	zassert_ok(flash_erase(flash, offset, MODEL_SIZE));
+	zassert_ok(flash_write(flash, offset, model, sizeof(model)));
+
+	CachedDataLoader loader(flash, offset, sizeof(model), cache, sizeof(cache));
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < 3; i++) {
+			load_and_free(loader, i);
+		}
+	}
+
+	CachedDataLoader::Stats stats = loader.stats();
+
+	zassert_equal(stats.misses, 3);
+	zassert_equal(stats.hits, 3);
+	zassert_equal(stats.bytes_loaded, 3 * SEGMENT_SIZE);
+
+	/* A flash source cannot be used in place, so the segment must fit */
+	Result<FreeableBuffer> large = loader.load(0, CACHE_SIZE + 256, segment_info);
+
+	zassert_false(large.ok());
+	zassert_equal(large.error(), Error::MemoryAllocationFailed);
+	zassert_equal(loader.stats().bypasses, 0);
+}
+
+ZTEST_SUITE(cached_data_loader, NULL, setup, NULL, NULL, NULL);
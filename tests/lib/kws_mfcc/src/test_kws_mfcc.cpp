@@ -0,0 +1,113 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "Mfcc.hpp"
+#include "MfccQ15.hpp"
+
+#include <zephyr/ztest.h>
+#include <cstdlib>
+
+using arm::app::audio::MFCC;
+using arm::app::audio::MfccParams;
+using arm::app::audio::MfccQ15;
+
+/* MicroNet KWS front end parameters. */
+#define SAMPLING_FREQ  16000
+#define NUM_FBANK_BINS 40
+#define MEL_LO_FREQ    20
+#define MEL_HI_FREQ    4000
+#define NUM_FEATURES   10
+#define FRAME_LEN      640
+
+/* Quantisation of the model input and allowed difference in quantisation steps. */
+#define QUANT_SCALE     1.5f
+#define QUANT_OFFSET    20
+#define MAX_QUANT_DIFF  2
+
+static MFCC *mfcc_f32;
+static MfccQ15 *mfcc_q15;
+static int16_t frame[FRAME_LEN];
+
+/* Tone plus pseudo random noise, amplitude in LSBs. */
+static void make_frame(int amplitude, int tone_hz, uint32_t seed)
+{
+	for (int i = 0; i < FRAME_LEN; i++) {
+		seed = seed * 1103515245u + 12345u;
+		const float noise = (static_cast<int>((seed >> 16) & 0x7fff) - 16384) / 16384.0f;
+		const float tone = sinf(2.0f * static_cast<float>(M_PI) * tone_hz * i / SAMPLING_FREQ);
+
+		frame[i] = static_cast<int16_t>(amplitude * (0.5f * noise + 0.5f * tone));
+	}
+}
+
+static void compare_quantised(void)
+{
+	int8_t expected[NUM_FEATURES];
+	int8_t actual[NUM_FEATURES];
+
+	mfcc_f32->MfccComputeQuant<int8_t>(frame, QUANT_SCALE, QUANT_OFFSET, expected);
+	mfcc_q15->MfccComputeQuant<int8_t>(frame, QUANT_SCALE, QUANT_OFFSET, actual);
+
+	for (int i = 0; i < NUM_FEATURES; i++) {
+		zassert_true(abs(expected[i] - actual[i]) <= MAX_QUANT_DIFF,
+			     "feature %d: float %d, q15 %d", i, expected[i], actual[i]);
+	}
+}
+
+static void *kws_mfcc_setup(void)
+{
+	const MfccParams params(SAMPLING_FREQ, NUM_FBANK_BINS, MEL_LO_FREQ, MEL_HI_FREQ,
+				NUM_FEATURES, FRAME_LEN, true);
+
+	mfcc_f32 = new MFCC(params);
+	mfcc_f32->Init();
+	mfcc_q15 = new MfccQ15(params);
+	mfcc_q15->Init();
+
+	return NULL;
+}
+
+ZTEST(kws_mfcc, test_silence)
+{
+	float expected[NUM_FEATURES];
+	float actual[NUM_FEATURES];
+
+	memset(frame, 0, sizeof(frame));
+	mfcc_f32->MfccCompute(frame, expected);
+	mfcc_q15->MfccCompute(frame, actual);
+
+	for (int i = 0; i < NUM_FEATURES; i++) {
+		zassert_within(actual[i], expected[i], 0.1f, "feature %d: float %f, q15 %f", i,
+			       (double)expected[i], (double)actual[i]);
+	}
+
+	compare_quantised();
+}
+
+ZTEST(kws_mfcc, test_levels)
+{
+	/* From just above the noise floor to near full scale, the Q15 path rescales
+	 * each frame so quiet input must not lose precision. */
+	static const int amplitudes[] = {30, 100, 300, 1000, 3000, 8000, 20000, 32000};
+
+	for (size_t i = 0; i < ARRAY_SIZE(amplitudes); i++) {
+		make_frame(amplitudes[i], 300 + 150 * i, i + 1);
+		compare_quantised();
+	}
+}
+
+ZTEST(kws_mfcc, test_tones)
+{
+	for (int tone_hz = 100; tone_hz < SAMPLING_FREQ / 2; tone_hz += 700) {
+		make_frame(4000, tone_hz, tone_hz);
+		compare_quantised();
+	}
+}
+
+ZTEST_SUITE(kws_mfcc, NULL, kws_mfcc_setup, NULL, NULL, NULL);
@@ -0,0 +1,213 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "fused_pipeline.h"
+
+#include <aipl_color_correction.h>
+#include <aipl_demosaic.h>
+#include <aipl_lut_transform.h>
+#include <aipl_resize.h>
+
+#include <zephyr/ztest.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define SRC_WIDTH  64
+#define SRC_HEIGHT 48
+
+#define CROP_X      8
+#define CROP_Y      4
+#define CROP_WIDTH  48
+#define CROP_HEIGHT 40
+
+/* Rounding differs between the passes, the LUT can amplify it */
+#define MAX_DIFF       6
+#define MAX_MEAN_DIFF  1.0
+
+static const struct {
+	uint16_t width;
+	uint16_t height;
+} out_sizes[] = {
+	{20, 16}, /* Downscale as in the sample */
+	{33, 17}, /* Odd sizes, uneven steps */
+	{CROP_WIDTH, CROP_HEIGHT},
+};
+
+static const aipl_bayer_filter_t formats[] = {
+	AIPL_BAYER_RGGB,
+	AIPL_BAYER_GRBG,
+	AIPL_BAYER_GBRG,
+	AIPL_BAYER_BGGR,
+};
+
+static float ccm[9] = {1.2f, -0.1f, -0.1f, -0.1f, 1.2f, -0.1f, -0.1f, -0.1f, 1.2f};
+static uint8_t gamma_lut[256];
+
+static uint16_t raw10[SRC_WIDTH * SRC_HEIGHT];
+static uint8_t raw8[SRC_WIDTH * SRC_HEIGHT];
+static uint8_t demosaiced[CROP_WIDTH * CROP_HEIGHT * 3];
+static uint8_t reference[CROP_WIDTH * CROP_HEIGHT * 3];
+static uint8_t reference_gray[CROP_WIDTH * CROP_HEIGHT];
+static uint8_t fused_rgb[CROP_WIDTH * CROP_HEIGHT * 3];
+static uint8_t fused_gray[CROP_WIDTH * CROP_HEIGHT];
+
+static void *setup(void)
+{
+	/* Smooth, different in every Bayer channel and away from saturation */
+	for (uint32_t y = 0; y < SRC_HEIGHT; y++) {
+		for (uint32_t x = 0; x < SRC_WIDTH; x++) {
+			uint32_t site = (y & 1) * 2 + (x & 1);
+			double v = 512 + 250 * sin(x * 0.35 + site) + 150 * cos(y * 0.27 - site);
+			uint16_t v10 = (uint16_t)v & 0x3ff;
+
+			/* Upper bits are not part of the sample */
+			raw10[y * SRC_WIDTH + x] = v10 | 0xfc00;
+			raw8[y * SRC_WIDTH + x] = (v10 * 16336u + (1u << 15)) >> 16;
+		}
+	}
+
+	/* Non-linear, so it must come after the resize, but never steeper than pi / 2 */
+	for (int i = 0; i < 256; i++) {
+		gamma_lut[i] = (uint8_t)lroundf(127.5f - 127.5f * cosf(3.14159265f * i / 255.0f));
+	}
+
+	return NULL;
+}
+
+/* The separate passes of the sample, RgbToGrayscale() for the model input */
+static void run_reference(aipl_bayer_filter_t format, uint16_t width, uint16_t height)
+{
+	zassert_equal(aipl_demosaic(&raw8[CROP_Y * SRC_WIDTH + CROP_X], demosaiced, SRC_WIDTH,
+				    CROP_WIDTH, CROP_HEIGHT, format, AIPL_COLOR_RGB888),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_resize(demosaiced, reference, CROP_WIDTH, CROP_WIDTH, CROP_HEIGHT,
+				  AIPL_COLOR_RGB888, width, height, true),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_color_correction_rgb(reference, reference, width, width, height,
+						AIPL_COLOR_RGB888, ccm),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_lut_transform_rgb(reference, reference, width, width, height,
+					     AIPL_COLOR_RGB888, gamma_lut),
+		      AIPL_ERR_OK);
+
+	for (uint32_t i = 0; i < (uint32_t)width * height; i++) {
+		const uint8_t *p = &reference[i * 3];
+		uint32_t g = (uint32_t)(0.299f * p[0] + 0.587f * p[1] + 0.114f * p[2]);
+
+		reference_gray[i] = MIN(g, 255u);
+	}
+}
+
+static void check_close(const uint8_t *a, const uint8_t *b, uint32_t n, const char *what,
+			aipl_bayer_filter_t format, uint16_t width, uint16_t height)
+{
+	uint32_t sum = 0;
+	int max = 0;
+
+	for (uint32_t i = 0; i < n; i++) {
+		int d = abs(a[i] - b[i]);
+
+		max = MAX(max, d);
+		sum += d;
+	}
+
+	zassert_true(max <= MAX_DIFF, "%s of format %d at %ux%u off by %d", what, format, width,
+		     height, max);
+	zassert_true(sum <= MAX_MEAN_DIFF * n, "%s of format %d at %ux%u off by %u.%02u on average",
+		     what, format, width, height, sum / n, sum * 100 / n % 100);
+}
+
+ZTEST(object_detection_fused, test_matches_separate_passes)
+{
+	for (size_t f = 0; f < ARRAY_SIZE(formats); f++) {
+		for (size_t s = 0; s < ARRAY_SIZE(out_sizes); s++) {
+			const uint16_t width = out_sizes[s].width;
+			const uint16_t height = out_sizes[s].height;
+			const struct fused_pipeline_config cfg = {
+				.src_width = SRC_WIDTH,
+				.src_height = SRC_HEIGHT,
+				.crop_x = CROP_X,
+				.crop_y = CROP_Y,
+				.crop_width = CROP_WIDTH,
+				.crop_height = CROP_HEIGHT,
+				.dst_width = width,
+				.dst_height = height,
+				.bayer_format = formats[f],
+				.ccm = ccm,
+				.gamma_lut = gamma_lut,
+			};
+			static struct fused_pipeline pipeline;
+
+			zassert_ok(fused_pipeline_init(&pipeline, &cfg));
+			fused_pipeline_run(&pipeline, (const uint8_t *)raw10, fused_rgb, fused_gray,
+					   false);
+			run_reference(formats[f], width, height);
+
+			check_close(fused_rgb, reference, width * height * 3, "RGB", formats[f],
+				    width, height);
+			check_close(fused_gray, reference_gray, width * height, "Gray", formats[f],
+				    width, height);
+		}
+	}
+}
+
+ZTEST(object_detection_fused, test_signed_gray)
+{
+	const struct fused_pipeline_config cfg = {
+		.src_width = SRC_WIDTH,
+		.src_height = SRC_HEIGHT,
+		.crop_width = SRC_WIDTH,
+		.crop_height = SRC_HEIGHT,
+		.dst_width = 16,
+		.dst_height = 12,
+		.bayer_format = AIPL_BAYER_RGGB,
+	};
+	static struct fused_pipeline pipeline;
+	static uint8_t gray_signed[16 * 12];
+
+	zassert_ok(fused_pipeline_init(&pipeline, &cfg));
+	fused_pipeline_run(&pipeline, (const uint8_t *)raw10, fused_rgb, fused_gray, false);
+	fused_pipeline_run(&pipeline, (const uint8_t *)raw10, fused_rgb, gray_signed, true);
+
+	for (size_t i = 0; i < ARRAY_SIZE(gray_signed); i++) {
+		zassert_equal((int8_t)gray_signed[i], fused_gray[i] - 128);
+	}
+}
+
+ZTEST(object_detection_fused, test_rejects_bad_geometry)
+{
+	struct fused_pipeline_config cfg = {
+		.src_width = SRC_WIDTH,
+		.src_height = SRC_HEIGHT,
+		.crop_x = CROP_X,
+		.crop_y = CROP_Y,
+		.crop_width = CROP_WIDTH,
+		.crop_height = CROP_HEIGHT,
+		.dst_width = 20,
+		.dst_height = 16,
+		.bayer_format = AIPL_BAYER_RGGB,
+	};
+	static struct fused_pipeline pipeline;
+
+	/* Odd crop offsets would change the Bayer phase */
+	cfg.crop_x = CROP_X + 1;
+	zassert_equal(fused_pipeline_init(&pipeline, &cfg), -EINVAL);
+	cfg.crop_x = CROP_X;
+
+	/* Outside the sensor frame */
+	cfg.crop_y = SRC_HEIGHT - CROP_HEIGHT + 2;
+	zassert_equal(fused_pipeline_init(&pipeline, &cfg), -EINVAL);
+	cfg.crop_y = CROP_Y;
+
+	/* No larger than the crop window */
+	cfg.dst_width = CROP_WIDTH + 2;
+	zassert_equal(fused_pipeline_init(&pipeline, &cfg), -EINVAL);
+}
+
+ZTEST_SUITE(object_detection_fused, NULL, setup, NULL, NULL, NULL);
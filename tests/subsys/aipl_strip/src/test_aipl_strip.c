@@ -0,0 +1,220 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "aipl_strip/aipl_strip.h"
+
+#include <aipl_color_conversion.h>
+#include <aipl_crop.h>
+#include <aipl_rotate.h>
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define SRC_WIDTH  64
+#define SRC_HEIGHT 48
+
+/* Scaled down horizontally and up vertically, 53 rows leave a tail of 4 for 7-row strips */
+#define CROP_X      5
+#define CROP_Y      3
+#define CROP_WIDTH  50
+#define CROP_HEIGHT 40
+#define OUT_WIDTH   36
+#define OUT_HEIGHT  53
+
+#define OUT_SIZE (OUT_WIDTH * OUT_HEIGHT * 2)
+
+static const struct aipl_strip_op ops[] = {
+	AIPL_STRIP_OP_CROP(CROP_X, CROP_Y, CROP_WIDTH, CROP_HEIGHT),
+	AIPL_STRIP_OP_RESIZE(OUT_WIDTH, OUT_HEIGHT, true),
+	AIPL_STRIP_OP_CONVERT(AIPL_COLOR_RGB565),
+	AIPL_STRIP_OP_ROTATE_180(),
+};
+
+static const uint32_t strip_heights[] = {1, 7, OUT_HEIGHT};
+
+static aipl_image_t src;
+static uint8_t reference[OUT_SIZE];
+static uint8_t strip_out[ARRAY_SIZE(strip_heights)][OUT_SIZE];
+
+/* Whole-image bilinear resize: centre aligned, clamped to the edge, 8-bit weights */
+static void reference_resize(const aipl_image_t *in, aipl_image_t *out)
+{
+	const uint32_t xstep = in->width * 0x10000 / out->width;
+	const uint32_t ystep = in->height * 0x10000 / out->height;
+	const uint8_t *s = in->data;
+	uint8_t *d = out->data;
+
+	for (uint32_t y = 0; y < out->height; y++) {
+		const int32_t py = CLAMP((int32_t)(ystep * y + ystep / 2) - 0x8000, 0,
+					 (int32_t)(in->height - 1) << 16);
+		const uint32_t y0 = py >> 16;
+		const uint32_t y1 = MIN(y0 + 1, in->height - 1);
+		const uint32_t fy = (py >> 8) & 0xff;
+
+		for (uint32_t x = 0; x < out->width; x++) {
+			const int32_t px = CLAMP((int32_t)(xstep * x + xstep / 2) - 0x8000, 0,
+						 (int32_t)(in->width - 1) << 16);
+			const uint32_t x0 = px >> 16;
+			const uint32_t x1 = MIN(x0 + 1, in->width - 1);
+			const uint32_t fx = (px >> 8) & 0xff;
+
+			for (uint32_t c = 0; c < 4; c++) {
+				const uint32_t top = s[(y0 * in->pitch + x0) * 4 + c] * (256 - fx) +
+						     s[(y0 * in->pitch + x1) * 4 + c] * fx;
+				const uint32_t bot = s[(y1 * in->pitch + x0) * 4 + c] * (256 - fx) +
+						     s[(y1 * in->pitch + x1) * 4 + c] * fx;
+
+				d[(y * out->pitch + x) * 4 + c] =
+					(top * (256 - fy) + bot * fy + 0x8000) >> 16;
+			}
+		}
+	}
+}
+
+/* The same chain with one full-size image per step */
+static void make_reference(void)
+{
+	aipl_image_t cropped, scaled, converted, rotated;
+
+	zassert_equal(aipl_image_create(&cropped, CROP_WIDTH, CROP_WIDTH, CROP_HEIGHT,
+					AIPL_COLOR_ARGB8888),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_image_create(&scaled, OUT_WIDTH, OUT_WIDTH, OUT_HEIGHT,
+					AIPL_COLOR_ARGB8888),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_image_create(&converted, OUT_WIDTH, OUT_WIDTH, OUT_HEIGHT,
+					AIPL_COLOR_RGB565),
+		      AIPL_ERR_OK);
+	zassert_equal(aipl_image_create(&rotated, OUT_WIDTH, OUT_WIDTH, OUT_HEIGHT,
+					AIPL_COLOR_RGB565),
+		      AIPL_ERR_OK);
+
+	zassert_equal(aipl_crop_img(&src, &cropped, CROP_X, CROP_Y, CROP_X + CROP_WIDTH,
+				    CROP_Y + CROP_HEIGHT),
+		      AIPL_ERR_OK);
+	reference_resize(&cropped, &scaled);
+	zassert_equal(aipl_color_convert_img(&scaled, &converted), AIPL_ERR_OK);
+	zassert_equal(aipl_rotate_img(&converted, &rotated, AIPL_ROTATE_180), AIPL_ERR_OK);
+
+	memcpy(reference, rotated.data, OUT_SIZE);
+
+	aipl_image_destroy(&cropped);
+	aipl_image_destroy(&scaled);
+	aipl_image_destroy(&converted);
+	aipl_image_destroy(&rotated);
+}
+
+static void *setup(void)
+{
+	uint8_t *p;
+
+	zassert_equal(aipl_image_create(&src, SRC_WIDTH, SRC_WIDTH, SRC_HEIGHT,
+					AIPL_COLOR_ARGB8888),
+		      AIPL_ERR_OK);
+
+	/* Gradients in every channel so that interpolation errors show up */
+	p = src.data;
+	for (uint32_t y = 0; y < SRC_HEIGHT; y++) {
+		for (uint32_t x = 0; x < SRC_WIDTH; x++) {
+			*p++ = (uint8_t)(x * 4);
+			*p++ = (uint8_t)(y * 5);
+			*p++ = (uint8_t)(x * y);
+			*p++ = 0xff;
+		}
+	}
+
+	make_reference();
+
+	return NULL;
+}
+
+static void teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	aipl_image_destroy(&src);
+}
+
+static void run_strips(uint32_t strip_rows, uint8_t *out)
+{
+	struct aipl_strip_pipeline pipeline;
+	aipl_image_t dst;
+
+	zassert_ok(aipl_strip_init(&pipeline, src.width, src.height, src.format, ops,
+				   ARRAY_SIZE(ops), strip_rows));
+	zassert_ok(aipl_strip_create_output(&pipeline, &dst));
+	zassert_equal(dst.width, OUT_WIDTH);
+	zassert_equal(dst.height, OUT_HEIGHT);
+	zassert_equal(dst.format, AIPL_COLOR_RGB565);
+
+	zassert_ok(aipl_strip_run(&pipeline, &src, &dst), "%u-row strips failed", strip_rows);
+	memcpy(out, dst.data, OUT_SIZE);
+
+	aipl_strip_release(&pipeline);
+	aipl_image_destroy(&dst);
+}
+
+ZTEST(aipl_strip, test_strip_heights_match_reference)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(strip_heights); i++) {
+		run_strips(strip_heights[i], strip_out[i]);
+		zassert_mem_equal(strip_out[i], reference, OUT_SIZE,
+				  "%u-row strips differ from the full-frame reference",
+				  strip_heights[i]);
+	}
+
+	for (size_t i = 1; i < ARRAY_SIZE(strip_heights); i++) {
+		zassert_mem_equal(strip_out[i], strip_out[0], OUT_SIZE,
+				  "%u-row strips differ from 1-row strips", strip_heights[i]);
+	}
+}
+
+ZTEST(aipl_strip, test_buffers_grow_with_strip_height)
+{
+	struct aipl_strip_pipeline small, full;
+
+	zassert_ok(aipl_strip_init(&small, src.width, src.height, src.format, ops,
+				   ARRAY_SIZE(ops), 1));
+	zassert_ok(aipl_strip_init(&full, src.width, src.height, src.format, ops,
+				   ARRAY_SIZE(ops), OUT_HEIGHT));
+
+	/* The crop is a view, only the resize and convert outputs are buffered */
+	zassert_is_null(small.stage[1].buf);
+	zassert_not_null(small.stage[2].buf);
+	zassert_not_null(small.stage[3].buf);
+	zassert_true(small.buf_size < full.buf_size);
+	zassert_equal(full.stage[2].buf_rows, OUT_HEIGHT);
+
+	aipl_strip_release(&small);
+	aipl_strip_release(&full);
+}
+
+ZTEST(aipl_strip, test_run_rejects_mismatched_images)
+{
+	struct aipl_strip_pipeline pipeline;
+	aipl_image_t dst;
+
+	zassert_ok(aipl_strip_init(&pipeline, src.width, src.height, src.format, ops,
+				   ARRAY_SIZE(ops), 8));
+	zassert_ok(aipl_strip_create_output(&pipeline, &dst));
+
+	aipl_image_t wrong_src = src;
+
+	wrong_src.height--;
+	zassert_equal(aipl_strip_run(&pipeline, &wrong_src, &dst), -EINVAL);
+
+	aipl_image_t wrong_dst = dst;
+
+	wrong_dst.format = AIPL_COLOR_ARGB8888;
+	zassert_equal(aipl_strip_run(&pipeline, &src, &wrong_dst), -EINVAL);
+
+	aipl_strip_release(&pipeline);
+	aipl_image_destroy(&dst);
+}
+
+ZTEST_SUITE(aipl_strip, NULL, setup, NULL, NULL, teardown);
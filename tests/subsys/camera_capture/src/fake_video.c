@@ -0,0 +1,134 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "fake_video.h"
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+
+static K_FIFO_DEFINE(fifo_in);
+static K_FIFO_DEFINE(fifo_out);
+static atomic_t queued;
+
+static const struct video_format_cap fake_fmts[] = {
+	{
+		.pixelformat = VIDEO_PIX_FMT_RGB565,
+		.width_min = FAKE_VIDEO_WIDTH,
+		.width_max = FAKE_VIDEO_WIDTH,
+		.height_min = FAKE_VIDEO_HEIGHT,
+		.height_max = FAKE_VIDEO_HEIGHT,
+	},
+	{0},
+};
+
+static int fake_set_format(const struct device *dev, enum video_endpoint_id ep,
+			   struct video_format *fmt)
+{
+	if (fmt->pixelformat != VIDEO_PIX_FMT_RGB565 || fmt->width != FAKE_VIDEO_WIDTH ||
+	    fmt->height != FAKE_VIDEO_HEIGHT) {
+		return -ENOTSUP;
+	}
+	return 0;
+}
+
+static int fake_get_caps(const struct device *dev, enum video_endpoint_id ep,
+			 struct video_caps *caps)
+{
+	caps->format_caps = fake_fmts;
+	caps->min_vbuf_count = 1;
+	return 0;
+}
+
+static int fake_stream(const struct device *dev)
+{
+	return 0;
+}
+
+static int fake_enqueue(const struct device *dev, enum video_endpoint_id ep,
+			struct video_buffer *vbuf)
+{
+	atomic_inc(&queued);
+	k_fifo_put(&fifo_in, vbuf);
+	return 0;
+}
+
+static int fake_dequeue(const struct device *dev, enum video_endpoint_id ep,
+			struct video_buffer **vbuf, k_timeout_t timeout)
+{
+	*vbuf = k_fifo_get(&fifo_out, timeout);
+	return *vbuf ? 0 : -EAGAIN;
+}
+
+static const struct video_driver_api fake_video_api = {
+	.set_format = fake_set_format,
+	.get_caps = fake_get_caps,
+	.stream_start = fake_stream,
+	.stream_stop = fake_stream,
+	.enqueue = fake_enqueue,
+	.dequeue = fake_dequeue,
+};
+
+DEVICE_DEFINE(fake_video, "fake_video", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_video_api);
+
+const struct device *fake_video_device(void)
+{
+	return DEVICE_GET(fake_video);
+}
+
+bool fake_video_capture(void)
+{
+	struct video_buffer *vbuf = k_fifo_get(&fifo_in, K_NO_WAIT);
+
+	if (!vbuf) {
+		return false;
+	}
+
+	atomic_dec(&queued);
+	fake_video_complete(vbuf);
+	return true;
+}
+
+bool fake_video_remove(struct video_buffer *vbuf)
+{
+	struct video_buffer *kept[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX + 1];
+	struct video_buffer *cur;
+	int count = 0;
+	bool found = false;
+
+	/* Keep the order of the other buffers */
+	while ((cur = k_fifo_get(&fifo_in, K_NO_WAIT)) != NULL) {
+		if (cur == vbuf) {
+			found = true;
+		} else if (count < ARRAY_SIZE(kept)) {
+			kept[count++] = cur;
+		}
+	}
+
+	for (int i = 0; i < count; i++) {
+		k_fifo_put(&fifo_in, kept[i]);
+	}
+
+	if (found) {
+		atomic_dec(&queued);
+	}
+	return found;
+}
+
+void fake_video_complete(struct video_buffer *vbuf)
+{
+	vbuf->bytesused = vbuf->size;
+	vbuf->timestamp = k_uptime_get_32();
+	k_fifo_put(&fifo_out, vbuf);
+}
+
+int fake_video_queued(void)
+{
+	return (int)atomic_get(&queued);
+}
@@ -0,0 +1,34 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#ifndef FAKE_VIDEO_H_
+#define FAKE_VIDEO_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/video.h>
+
+#define FAKE_VIDEO_WIDTH  4
+#define FAKE_VIDEO_HEIGHT 4
+
+/* Video device completing a frame only when the test asks for it. */
+const struct device *fake_video_device(void);
+
+/* Complete the oldest queued buffer, false if the driver holds none. */
+bool fake_video_capture(void);
+
+/* Complete a buffer the driver was never given. */
+void fake_video_complete(struct video_buffer *vbuf);
+
+/* Buffers queued to the driver and not completed yet. */
+int fake_video_queued(void);
+
+/* Remove a queued buffer from the driver without completing it. */
+bool fake_video_remove(struct video_buffer *vbuf);
+
+#endif /* FAKE_VIDEO_H_ */
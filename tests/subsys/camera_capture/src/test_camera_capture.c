@@ -0,0 +1,171 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "camera_capture/camera_capture.h"
+#include "fake_video.h"
+
+#include <zephyr/ztest.h>
+
+#define NUM_BUFFERS 3
+
+/* Let the capture thread pick up completed buffers */
+#define SETTLE K_MSEC(5)
+
+static void capture_frames(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_true(fake_video_capture(), "driver has no buffer for frame %d", i);
+		k_sleep(SETTLE);
+	}
+}
+
+static void *setup(void)
+{
+	const struct camera_capture_config cfg = {
+		.pixelformat = VIDEO_PIX_FMT_RGB565,
+		.num_buffers = NUM_BUFFERS,
+		.mode = IS_ENABLED(CONFIG_TEST_CAMERA_CAPTURE_FIFO) ? CAMERA_CAPTURE_FIFO
+								     : CAMERA_CAPTURE_LATEST,
+	};
+
+	zassert_ok(camera_capture_init(fake_video_device(), &cfg));
+	zassert_ok(camera_capture_start());
+	zassert_equal(fake_video_queued(), NUM_BUFFERS);
+
+	return NULL;
+}
+
+/* Every test starts with all buffers queued to the driver */
+static void drain(void *fixture)
+{
+	struct camera_frame *frame;
+
+	ARG_UNUSED(fixture);
+
+	while ((frame = camera_capture_get(K_NO_WAIT)) != NULL) {
+		camera_frame_unref(frame);
+	}
+	zassert_equal(fake_video_queued(), NUM_BUFFERS, "buffer leaked");
+}
+
+ZTEST(camera_capture, test_fifo_delivers_in_order)
+{
+	struct camera_frame *frames[NUM_BUFFERS];
+	struct camera_capture_stats start, end;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_TEST_CAMERA_CAPTURE_FIFO);
+
+	camera_capture_get_stats(&start);
+	capture_frames(NUM_BUFFERS);
+	zassert_equal(fake_video_queued(), 0);
+
+	for (int i = 0; i < NUM_BUFFERS; i++) {
+		frames[i] = camera_capture_get(K_NO_WAIT);
+		zassert_not_null(frames[i], "frame %d missing", i);
+		if (i > 0) {
+			zassert_equal(frames[i]->sequence, frames[i - 1]->sequence + 1);
+			zassert_not_equal(frames[i], frames[i - 1]);
+		}
+	}
+	zassert_is_null(camera_capture_get(K_NO_WAIT));
+
+	for (int i = 0; i < NUM_BUFFERS; i++) {
+		camera_frame_unref(frames[i]);
+	}
+
+	camera_capture_get_stats(&end);
+	zassert_equal(end.captured - start.captured, NUM_BUFFERS);
+	zassert_equal(end.delivered - start.delivered, NUM_BUFFERS);
+	zassert_equal(end.dropped, start.dropped);
+}
+
+ZTEST(camera_capture, test_latest_keeps_newest)
+{
+	struct camera_capture_stats start, end;
+	struct camera_frame *frame;
+	uint32_t first;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_TEST_CAMERA_CAPTURE_FIFO);
+
+	camera_capture_get_stats(&start);
+	capture_frames(1);
+
+	frame = camera_capture_get(K_NO_WAIT);
+	zassert_not_null(frame);
+	first = frame->sequence;
+	camera_frame_unref(frame);
+
+	/* Nobody takes the first two, each is recycled by the next one */
+	capture_frames(NUM_BUFFERS);
+	zassert_equal(fake_video_queued(), NUM_BUFFERS - 1);
+
+	frame = camera_capture_get(K_NO_WAIT);
+	zassert_not_null(frame);
+	zassert_equal(frame->sequence, first + NUM_BUFFERS);
+	zassert_is_null(camera_capture_get(K_NO_WAIT));
+	camera_frame_unref(frame);
+
+	camera_capture_get_stats(&end);
+	zassert_equal(end.captured - start.captured, NUM_BUFFERS + 1);
+	zassert_equal(end.delivered - start.delivered, 2);
+	zassert_equal(end.dropped - start.dropped, NUM_BUFFERS - 1);
+}
+
+ZTEST(camera_capture, test_recycled_after_last_consumer)
+{
+	struct camera_frame *frame;
+
+	capture_frames(1);
+	frame = camera_capture_get(K_NO_WAIT);
+	zassert_not_null(frame);
+	zassert_equal(fake_video_queued(), NUM_BUFFERS - 1);
+
+	/* Second consumer, e.g. display and inference */
+	camera_frame_ref(frame);
+
+	camera_frame_unref(frame);
+	zassert_equal(fake_video_queued(), NUM_BUFFERS - 1, "recycled while still in use");
+
+	camera_frame_unref(frame);
+	zassert_equal(fake_video_queued(), NUM_BUFFERS);
+}
+
+ZTEST(camera_capture, test_writable_only_when_sole_holder)
+{
+	struct camera_frame *frame;
+
+	capture_frames(1);
+	frame = camera_capture_get(K_NO_WAIT);
+	zassert_not_null(frame);
+	zassert_equal_ptr(camera_frame_writable(frame), frame->data);
+
+	camera_frame_ref(frame);
+	zassert_is_null(camera_frame_writable(frame), "shared frame handed out for writing");
+
+	camera_frame_unref(frame);
+	zassert_equal_ptr(camera_frame_writable(frame), frame->data);
+	camera_frame_unref(frame);
+}
+
+ZTEST(camera_capture, test_unknown_buffer_requeued)
+{
+	static uint8_t data[32];
+	static struct video_buffer foreign = {
+		.buffer = data,
+		.size = sizeof(data),
+	};
+
+	fake_video_complete(&foreign);
+	k_sleep(SETTLE);
+
+	zassert_is_null(camera_capture_get(K_NO_WAIT));
+	zassert_true(fake_video_remove(&foreign), "buffer not given back to the driver");
+}
+
+ZTEST_SUITE(camera_capture, NULL, setup, NULL, drain, NULL);
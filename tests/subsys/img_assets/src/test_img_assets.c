@@ -0,0 +1,85 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "img_assets/assets.h"
+#include "img_assets/img_asset_data.h"
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+
+#define STREAM_ROWS 7
+
+static uint8_t buf[480 * 360 * 4];
+static uint8_t stream_buf[480 * 360 * 4];
+
+/* The compressed photo must expand to exactly the pre-converted arrays. */
+ZTEST(img_assets, test_matches_raw)
+{
+	const image_t *const raw[] = {
+		&SAMPLE_PHOTO_ALPHA8,   &SAMPLE_PHOTO_ARGB8888, &SAMPLE_PHOTO_ARGB4444,
+		&SAMPLE_PHOTO_ARGB1555, &SAMPLE_PHOTO_RGBA8888, &SAMPLE_PHOTO_RGBA4444,
+		&SAMPLE_PHOTO_RGBA5551, &SAMPLE_PHOTO_RGB888,   &SAMPLE_PHOTO_RGB565,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(raw); i++) {
+		const image_t *img = raw[i];
+
+		zassert_equal(img_asset_decode(&IMG_ASSET_SAMPLE_PHOTO, img->format, buf, img->pitch),
+			      0, "format %u", img->format);
+		zassert_mem_equal(buf, img->data, img->data_size, "format %u", img->format);
+	}
+}
+
+ZTEST(img_assets, test_stream_rows)
+{
+	const struct img_asset *asset = img_asset_find("sample_photo");
+	const uint32_t line = asset->width * 4;
+	struct img_asset_decoder dec;
+	uint32_t y = 0;
+	int ret;
+
+	zassert_equal_ptr(asset, &IMG_ASSET_SAMPLE_PHOTO);
+	zassert_ok(img_asset_decoder_init(&dec, asset));
+
+	while ((ret = img_asset_decode_rows(&dec, COLOR_ARGB8888, &stream_buf[y * line],
+					    asset->width, STREAM_ROWS)) > 0) {
+		y += ret;
+	}
+
+	zassert_equal(ret, 0);
+	zassert_equal(y, asset->height);
+	zassert_ok(img_asset_decode(asset, COLOR_ARGB8888, buf, asset->width));
+	zassert_mem_equal(stream_buf, buf, line * asset->height);
+}
+
+ZTEST(img_assets, test_errors)
+{
+	struct img_asset asset = IMG_ASSET_SAMPLE_PHOTO;
+
+	zassert_is_null(img_asset_find("missing"));
+	zassert_equal(img_asset_bytes_per_pixel(COLOR_NV12), 0);
+	zassert_equal(img_asset_decode(&asset, COLOR_NV12, buf, asset.width), -ENOTSUP);
+	zassert_equal(img_asset_decode(&asset, COLOR_RGB565, buf, asset.width - 1), -EINVAL);
+
+	asset.width /= 2;
+	zassert_equal(img_asset_decode(&asset, COLOR_RGB565, buf, asset.width), -EINVAL);
+
+	/* Drop the middle of the stream but keep a valid end marker */
+	static uint8_t truncated[4096];
+
+	asset = IMG_ASSET_SAMPLE_PHOTO;
+	memcpy(truncated, asset.data, sizeof(truncated) - 8);
+	memcpy(&truncated[sizeof(truncated) - 8], asset.data + asset.data_size - 8, 8);
+	asset.data = truncated;
+	asset.data_size = sizeof(truncated);
+	zassert_equal(img_asset_decode(&asset, COLOR_RGB565, buf, asset.width), -EIO);
+}
+
+ZTEST_SUITE(img_assets, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,203 @@
+/* Copyright (C) 2025 Alif Semiconductor - All Rights Reserved.
+ * Use, distribution and modification of this code is permitted under the
+ * terms stated in the Alif Semiconductor Software License Agreement
+ *
+ * You should have received a copy of the Alif Semiconductor Software
+ * License Agreement with this file. If not, please write to:
+ * contact@alifsemi.com, or visit: https://alifsemi.com/license
+ */
+
+#include "video_pool/video_pool.h"
+
+#include <zephyr/ztest.h>
+
+/* Pooled blocks, 40960-byte class; only one fits the 64 KiB cache limit */
+#define BLOCK_SIZE 40000
+
+/* Block size of the only class with a live buffer, 0 if there is none */
+static size_t live_class_size(void)
+{
+	struct video_pool_class_stats cs;
+	size_t found = 0;
+
+	for (size_t i = 0; i < video_pool_num_classes(); i++) {
+		zassert_ok(video_pool_get_class_stats(i, &cs));
+		if (cs.live > 0) {
+			zassert_equal(found, 0, "more than one class in use");
+			zassert_equal(cs.live, 1);
+			found = cs.block_size;
+		}
+	}
+
+	return found;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	video_pool_trim();
+	video_pool_reset_stats();
+}
+
+static void after(void *fixture)
+{
+	struct video_pool_stats st;
+
+	ARG_UNUSED(fixture);
+
+	video_pool_get_stats(&st);
+	zassert_equal(st.live_bytes, 0, "buffer leaked");
+	video_pool_trim();
+}
+
+ZTEST(video_pool, test_class_rounding)
+{
+	static const size_t sizes[] = {4097, 5000, 6144, 8193, 65537, 150000};
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		void *ptr = video_pool_alloc(sizes[i]);
+		size_t block;
+
+		zassert_not_null(ptr, "%zu bytes not allocated", sizes[i]);
+		zassert_equal((uintptr_t)ptr % 32, 0, "%zu bytes not aligned", sizes[i]);
+
+		/* At most one eighth larger than asked for */
+		block = live_class_size();
+		zassert_true(block >= sizes[i], "%zu bytes in a %zu class", sizes[i], block);
+		zassert_true(block * 8 <= sizes[i] * 9, "%zu bytes in a %zu class", sizes[i],
+			     block);
+
+		video_pool_free(ptr);
+	}
+
+	/* Small requests go straight to the backend */
+	void *small = video_pool_alloc(4096);
+
+	zassert_not_null(small);
+	zassert_equal(live_class_size(), 0);
+	video_pool_free(small);
+}
+
+ZTEST(video_pool, test_reuse)
+{
+	struct video_pool_stats st;
+	void *first = video_pool_alloc(BLOCK_SIZE);
+	void *other;
+	void *again;
+
+	zassert_not_null(first);
+	video_pool_free(first);
+
+	video_pool_get_stats(&st);
+	zassert_true(st.cached_bytes > BLOCK_SIZE);
+
+	/* Same class, a little smaller */
+	again = video_pool_alloc(BLOCK_SIZE - 1000);
+	zassert_equal(again, first, "cached block not reused");
+
+	/* Another class must not take it */
+	other = video_pool_alloc(BLOCK_SIZE * 2);
+	zassert_not_null(other);
+	zassert_not_equal(other, first);
+
+	video_pool_get_stats(&st);
+	zassert_equal(st.allocs, 3);
+	zassert_equal(st.hits, 1);
+	zassert_equal(st.cached_bytes, 0);
+
+	video_pool_free(again);
+	video_pool_free(other);
+}
+
+ZTEST(video_pool, test_cache_limit)
+{
+	struct video_pool_class_stats cs;
+	struct video_pool_stats st;
+	void *a = video_pool_alloc(BLOCK_SIZE);
+	void *b = video_pool_alloc(BLOCK_SIZE);
+	size_t block;
+
+	zassert_not_null(a);
+	zassert_not_null(b);
+	video_pool_free(a);
+	block = live_class_size();
+	video_pool_free(b);
+
+	/* The second block would exceed CONFIG_VIDEO_POOL_CACHE_LIMIT */
+	video_pool_get_stats(&st);
+	zassert_true(st.cached_bytes >= block);
+	zassert_true(st.cached_bytes <= CONFIG_VIDEO_POOL_CACHE_LIMIT * 1024);
+
+	for (size_t i = 0; i < video_pool_num_classes(); i++) {
+		zassert_ok(video_pool_get_class_stats(i, &cs));
+		if (cs.block_size == block) {
+			zassert_equal(cs.cached, 1);
+		}
+	}
+}
+
+ZTEST(video_pool, test_trim)
+{
+	/* Three classes, all within the cache limit */
+	static const size_t sizes[] = {5000, 20000, 30000};
+	struct video_pool_stats st;
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		video_pool_free(video_pool_alloc(sizes[i]));
+	}
+
+	zassert_equal(video_pool_trim(), ARRAY_SIZE(sizes));
+	zassert_equal(video_pool_trim(), 0);
+
+	video_pool_get_stats(&st);
+	zassert_equal(st.cached_bytes, 0);
+	zassert_equal(st.trimmed, ARRAY_SIZE(sizes));
+
+	/* Nothing left to reuse */
+	void *ptr = video_pool_alloc(5000);
+
+	video_pool_get_stats(&st);
+	zassert_equal(st.hits, 0);
+	video_pool_free(ptr);
+}
+
+ZTEST(video_pool, test_probe_heap)
+{
+	struct video_pool_heap_stats start, hole, end;
+	void *a;
+	void *b;
+	void *c;
+
+	video_pool_probe_heap(&start);
+	zassert_true(start.free_blocks >= 1);
+	zassert_true(start.largest_free > 3 * BLOCK_SIZE);
+	zassert_true(start.largest_free <= start.free_bytes);
+
+	/* Free the middle one of three blocks to leave a hole */
+	a = video_pool_alloc(BLOCK_SIZE);
+	b = video_pool_alloc(BLOCK_SIZE);
+	c = video_pool_alloc(BLOCK_SIZE);
+	zassert_not_null(a);
+	zassert_not_null(b);
+	zassert_not_null(c);
+	video_pool_free(b);
+	video_pool_trim();
+
+	video_pool_probe_heap(&hole);
+	zassert_true(hole.free_bytes < start.free_bytes);
+	zassert_true(hole.largest_free < start.largest_free);
+	zassert_true(hole.free_blocks >= 2, "hole not found");
+	zassert_true(hole.largest_free < hole.free_bytes);
+
+	video_pool_free(a);
+	video_pool_free(c);
+	video_pool_trim();
+
+	/* Measuring must not leave anything behind */
+	video_pool_probe_heap(&end);
+	zassert_equal(end.largest_free, start.largest_free);
+	zassert_equal(end.free_bytes, start.free_bytes);
+}
+
+ZTEST_SUITE(video_pool, NULL, NULL, before, after, NULL);